@@ -8,6 +8,9 @@
  * Includes
  ******************************************************************************/
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <iostream>
 
 #include "src/arena.h"
@@ -19,23 +22,90 @@
  ******************************************************************************/
 NAMESPACE_BEGIN(csci3081);
 
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+// Longest contact prediction, in ticks
+static const double kMaxContactTicks = 1e9;
+// Distance kept in hand against rounding when predicting contacts
+static const double kContactSlack = 1e-6;
+
 /*******************************************************************************
  * Constructors/Destructor
  ******************************************************************************/
 Arena::Arena(const struct arena_params *const params)
   : x_dim_(params->x_dim),
     y_dim_(params->y_dim),
-    factory_(new EntityFactory),
+    factory_(new EntityFactory(*params)),
+    profiles_(),
+    pool_(new ThreadPool(params->n_threads, PARALLEL_MIN_CHUNK)),
+    tick_graph_(),
+    tick_graph_generation_(std::numeric_limits<unsigned int>::max()),
+    robot_motion_(),
+    light_motion_(),
+    robot_fixed_motion_(),
+    light_fixed_motion_(),
+    light_slot_(),
+    robot_order_(),
+    behaviors_(),
     entities_(),
     light_entities_(),
     robot_entities_(),
     food_entities_(),
     mobile_entities_(),
-    game_status_(PAUSED) {
+    game_status_(PAUSED),
+    generation_(0),
+    tick_(0),
+    time_remainder_(0),
+    event_driven_(params->event_driven),
+    next_contact_(),
+    contact_generation_(std::numeric_limits<unsigned int>::max()),
+    contact_checks_(0),
+    contact_candidates_(0),
+    adaptive_step_(params->adaptive_step),
+    step_tolerance_(params->step_tolerance),
+    max_step_ticks_(std::max(params->max_step_ticks, 1u)),
+    step_ticks_(1),
+    step_velocity_(),
+    velocity_tick_(0),
+    step_generation_(std::numeric_limits<unsigned int>::max()),
+    steps_(0),
+    ballistic_lights_(params->ballistic_lights),
+    fixed_point_(params->fixed_point) {
+    for (int i = kAggressive; i < kNumRobotBehaviors; i++) {
+      RobotProfile &prof = profiles_.at(static_cast<RobotBehaviorEnum>(i));
+      prof.hunger = params->robot_hunger;
+      prof.starve = params->robot_starve;
+      prof.death = params->robot_death;
+      prof.max_sens = params->max_sens;
+      prof.max_speed = params->robot_max_speed;
+      prof.max_angle = params->robot_max_angle;
+      prof.min_radius = params->robot_min_radius;
+      prof.max_radius = params->robot_max_radius;
+      prof.arc_ticks = params->arc_ticks;
+      prof.light_numerator = params->light_numerator;
+      prof.food_numerator = params->food_numerator;
+    }
+    profiles_.at(kFear).color = params->fear_color;
+    profiles_.at(kAggressive).color = params->aggressive_color;
+    profiles_.at(kExplore).color = params->explore_color;
+    profiles_.at(kLove).color = params->love_color;
+    profiles_.at(kNeural).color = params->neural_color;
+    profiles_.at(kNothing).color = params->robot_color;
+    profiles_.at(kFear).matrix = params->fear_matrix;
+    profiles_.at(kAggressive).matrix = params->aggressive_matrix;
+    profiles_.at(kExplore).matrix = params->explore_matrix;
+    profiles_.at(kLove).matrix = params->love_matrix;
+    profiles_.at(kNeural).network = params->neural_network;
+    // robots without a behavior are given fear
+    profiles_.at(kNothing).matrix = params->fear_matrix;
+    factory_->set_profile_table(&profiles_);
+
     AddRobot(params->n_fear_robots, kFear);
     AddRobot(params->n_aggressive_robots, kAggressive);
     AddRobot(params->n_explore_robots, kExplore);
     AddRobot(params->n_love_robots, kLove);
+    AddRobot(params->n_neural_robots, kNeural);
     AddFood(params->n_foods);
     AddLight(params->n_lights);
 }
@@ -44,47 +114,52 @@ Arena::~Arena() {
   for (auto ent : entities_) {
     delete ent;
   } /* for(ent..) */
+  delete factory_;
+  delete pool_;
 }
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 void Arena::AddRobot(int quantity, RobotBehaviorEnum behv) {
-  for (int i = 0; i < quantity; i++) {
-    robot_ = dynamic_cast<Robot *>(factory_->CreateEntity(kRobot));
-    // set the robot's behavior type
-    robot_->set_behavior_enum(behv);
-    // ensure that the robot has the correct behavior member
-    robot_->set_behavior_handler();
-    // change the color of the robot depending on the type
-    robot_->UpdateColor(behv);
-
-    incrementRobotCount(behv);
-
-    // ensure robot is pushed to all the vectors it belongs to
-    entities_.push_back(robot_);
-    robot_entities_.push_back(robot_);
-    mobile_entities_.push_back(robot_);
-  }
+  if (quantity <= 0) return;
+  size_t first = robot_entities_.size();
+  // the factory builds the whole batch with its behavior and counts it
+  factory_->CreateRobots(quantity, behv, &robot_entities_);
+
+  // ensure the batch is pushed to all the vectors it belongs to
+  auto batch = robot_entities_.begin() + first;
+  entities_.insert(entities_.end(), batch, robot_entities_.end());
+  mobile_entities_.insert(mobile_entities_.end(), batch,
+                          robot_entities_.end());
+  robot_ = robot_entities_.back();
+  ++generation_;
 }
 
 void Arena::AddLight(int quantity) {
-  for (int i = 0; i < quantity; i++) {
-    light_ = dynamic_cast<Light *>(factory_->CreateEntity(kLight));
-    // ensure light is pushed to all the vectors it belongs to
-    entities_.push_back(light_);
-    light_entities_.push_back(light_);
-    mobile_entities_.push_back(light_);
-  }
+  if (quantity <= 0) return;
+  size_t first = light_entities_.size();
+  factory_->CreateLights(quantity, &light_entities_);
+
+  // ensure the batch is pushed to all the vectors it belongs to
+  auto batch = light_entities_.begin() + first;
+  entities_.insert(entities_.end(), batch, light_entities_.end());
+  mobile_entities_.insert(mobile_entities_.end(), batch,
+                          light_entities_.end());
+  light_ = light_entities_.back();
+  ++generation_;
 }
 
 void Arena::AddFood(int quantity) {
-  for (int i = 0; i < quantity; i++) {
-    food_ = dynamic_cast<Food *>(factory_->CreateEntity(kFood));
-    // ensure food is pushed to all the vectors it belongs to
-    entities_.push_back(food_);
-    food_entities_.push_back(food_);
-  }
+  if (quantity <= 0) return;
+  size_t first = food_entities_.size();
+  factory_->CreateFoods(quantity, &food_entities_);
+
+  // ensure the batch is pushed to all the vectors it belongs to
+  entities_.insert(entities_.end(), food_entities_.begin() + first,
+                   food_entities_.end());
+  food_ = food_entities_.back();
+  ++generation_;
 }
 
 void Arena::incrementRobotCount(RobotBehaviorEnum behv) {
@@ -97,6 +172,8 @@ void Arena::incrementRobotCount(RobotBehaviorEnum behv) {
       break;
     case kLove: factory_->love_robot_increment();
       break;
+    case kNeural: factory_->neural_robot_increment();
+      break;
     default: {}
   }
 }
@@ -111,6 +188,8 @@ void Arena::decrementRobotCount(RobotBehaviorEnum behv) {
       break;
     case kLove: factory_->love_robot_decrement();
       break;
+    case kNeural: factory_->neural_robot_decrement();
+      break;
     default: {}
   }
 }
@@ -119,55 +198,335 @@ void Arena::Reset() {
   for (auto ent : entities_) {
     ent->Reset();
   } /* for(ent..) */
+  // placed through the factory, so a new game uses the configured arena
+  // size and radii and draws from the arena's seeded generator
+  for (auto rob : robot_entities_) factory_->Place(rob);
+  for (auto light : light_entities_) factory_->Place(light);
+  for (auto food : food_entities_) factory_->Place(food);
+  ++generation_;
+  tick_ = 0;
+  steps_ = 0;
+  step_ticks_ = 1;
+  time_remainder_ = 0;
 } /* reset() */
 
 // The primary driver of simulation movement. Called from the Controller
 // but originated from the graphics viewer.
-void Arena::AdvanceTime(double dt) {
+unsigned long Arena::AdvanceTime(double dt, double budget) {
   if (!(dt > 0)) {
-    return;
+    return 0;
+  }
+  time_remainder_ += dt;
+  double steps = std::floor(time_remainder_ / TICK_TIME);
+  time_remainder_ -= steps * TICK_TIME;
+  if (steps > MAX_SUBSTEPS) {
+    // too far behind to catch up, so drop the backlog
+    steps = MAX_SUBSTEPS;
+    time_remainder_ = 0;
   }
-  for (size_t i = 0; i < 1; ++i) {
-    UpdateEntitiesTimestep();
-  } /* for(i..) */
+  return StepTicks(static_cast<unsigned long>(steps), budget);
 } /* AdvanceTime() */
 
+unsigned long Arena::StepTicks(unsigned long ticks, double budget) {
+  int status = game_status_;
+  auto deadline = std::chrono::steady_clock::now() +
+    std::chrono::duration<double>(budget);
+  unsigned long done = 0;
+  while (done < ticks) {
+    unsigned int step = NextStepTicks(ticks - done);
+    Step(step);
+    done += step;
+    if (game_status_ != status) {
+      return done;
+    }
+    if (budget > 0 && std::chrono::steady_clock::now() > deadline) {
+      return done;
+    }
+  } /* while(done..) */
+  return ticks;
+} /* StepTicks() */
+
 void Arena::UpdateEntitiesTimestep() {
+  Step(1);
+}  // UpdateEntitiesTimestep()
+
+void Arena::Step(unsigned int ticks) {
+  step_ticks_ = ticks;
+  tick_ += ticks;
+  ++steps_;
+
   /*
-   * First, update the position of all entities, according to their current
-   * velocities.
+   * First, update the position of all entities according to their current
+   * velocities, push the new light and food positions to the robots' sensors
+   * and check for win/loss. These run as a task graph on the thread pool.
    */
-  for (auto ent : entities_) {
-    ent->TimestepUpdate(1);
+  if (tick_graph_generation_ != generation_) {
+    BuildTickGraph();
   }
+  pool_->Run(&tick_graph_);
+
+  /* Determine if any mobile entity is colliding with a wall or another
+  * entity, and adjust positions so they don't overlap.
+  */
+  UpdateContacts();
+}  // Step()
+
+unsigned int Arena::NextStepTicks(unsigned long remaining) {
+  if (!adaptive_step_ || remaining <= 1) {
+    return 1;
+  }
+  double limit = std::min(static_cast<double>(remaining),
+                          static_cast<double>(max_step_ticks_));
+  // grow by at most a factor of two, so a step that turns out too long is
+  // soon followed by shorter ones
+  limit = std::min(limit, 2.0 * step_ticks_);
+
+  // stop at the first tick any entity could touch something
+  if (contact_generation_ != generation_) {
+    limit = 1;
+  } else {
+    for (unsigned long due : next_contact_) {
+      limit = std::min(limit,
+                       due > tick_ ? static_cast<double>(due - tick_) : 1.0);
+    }
+  }
+
+  // the wheel velocities in use were evaluated at the start of the last
+  // step; compare them with the ones seen before that
+  unsigned long now = tick_ > step_ticks_ ? tick_ - step_ticks_ : 0;
+  bool history = step_generation_ == generation_ && now > velocity_tick_;
+  if (step_generation_ != generation_) {
+    step_velocity_.resize(robot_entities_.size());
+    step_generation_ = generation_;
+  }
+  double span = history ? static_cast<double>(now - velocity_tick_) : 1.0;
+  double fastest = 0;
+  for (size_t i = 0; i < robot_entities_.size(); ++i) {
+    Robot *rob = robot_entities_[i];
+    WheelVelocity vel = rob->get_velocity();
+    fastest = std::max(fastest, std::max(
+      std::fabs(vel.left - step_velocity_[i].left),
+      std::fabs(vel.right - step_velocity_[i].right)) / span);
+    step_velocity_[i] = vel;
+    if (rob->get_food_flag()) {
+      // land on the tick a hunger timer runs out
+      if (!rob->get_dead())
+        limit = std::min(limit, std::ceil(rob->get_death_timer()));
+      if (!rob->get_is_starving())
+        limit = std::min(limit, std::ceil(rob->get_starving()));
+      if (!rob->get_is_hungry())
+        limit = std::min(limit, std::ceil(rob->get_hungry()));
+    }
+  }
+  velocity_tick_ = now;
+  if (!history) {
+    limit = 1;
+  } else if (fastest > 0) {
+    // holding a velocity that drifts by `fastest` per tick for n ticks is
+    // off by about 0.5 * fastest * n^2 at the end of the step
+    limit = std::min(limit, std::sqrt(2 * step_tolerance_ / fastest));
+  }
+  return static_cast<unsigned int>(std::max(limit, 1.0));
+}  // NextStepTicks()
+
+template <class Integrator>
+void Arena::MoveRobots(Integrator *motion, size_t begin, size_t end) {
+  for (size_t k = begin; k < end; ++k) {
+    Robot *rob = robot_entities_[robot_order_[k]];
+    // a robot in a reverse arc turns every tick, so it runs the step as
+    // single tick substeps of its own (below); it stays collided until
+    // the BeginStep() after its arc ends, which is how they are found
+    bool arc = rob->get_collision_cond() && rob->get_arc_ticks() > 0;
+    rob->BeginStep(arc ? 1 : step_ticks_);
+    behaviors_.Load(k, rob);
+  }
+  behaviors_.Decide(begin, end);
+  for (size_t k = begin; k < end; ++k) {
+    Robot *rob = robot_entities_[robot_order_[k]];
+    rob->get_motion_handler()->UpdateVelocity(behaviors_.get_velocity(k));
+    motion->Load(k, rob->get_pose(), rob->get_heading(), rob->get_velocity());
+  }
+  motion->Integrate(begin, end, step_ticks_);
+  for (size_t k = begin; k < end; ++k) {
+    Robot *rob = robot_entities_[robot_order_[k]];
+    if (step_ticks_ > 1 && rob->get_collision_cond()) {
+      // redo this slot tick by tick from the start pose, holding the
+      // behavior's velocity as the rest of the step does
+      for (unsigned int t = 0; t < step_ticks_; ++t) {
+        if (t > 0) {
+          rob->BeginStep(1);
+          rob->get_motion_handler()->UpdateVelocity(
+            behaviors_.get_velocity(k));
+        }
+        motion->Load(k, rob->get_pose(), rob->get_heading(),
+                     rob->get_velocity());
+        motion->Integrate(k, k + 1, 1);
+        rob->set_pose(motion->get_pose(k), motion->get_heading(k));
+        rob->FinishStep();
+      }
+      continue;
+    }
+    rob->set_pose(motion->get_pose(k), motion->get_heading(k));
+    rob->FinishStep();
+  }
+}
+
+template <class Integrator>
+void Arena::MoveLights(Integrator *motion, size_t begin, size_t end) {
+  bool ballistic = ballistic_lights_ && !fixed_point_;
+  size_t slots = begin;
+  for (size_t i = begin; i < end; ++i) {
+    Light *light = light_entities_[i];
+    if (ballistic && light->InFlight()) {
+      // tick_ is already the end of this step
+      light->Fly(tick_);
+      continue;
+    }
+    light_slot_[slots] = i;
+    motion->Load(slots++, light->get_pose(), light->get_heading(),
+                 light->get_velocity());
+  }
+  motion->Integrate(begin, slots, step_ticks_);
+  for (size_t s = begin; s < slots; ++s) {
+    Light *light = light_entities_[light_slot_[s]];
+    if (step_ticks_ > 1 && light->get_collision_cond()) {
+      // a light in a reverse arc turns every tick: redo it tick by tick
+      // from the start pose
+      for (unsigned int t = 0; t < step_ticks_; ++t) {
+        motion->Load(s, light->get_pose(), light->get_heading(),
+                     light->get_velocity());
+        motion->Integrate(s, s + 1, 1);
+        light->set_pose(motion->get_pose(s), motion->get_heading(s));
+        light->FinishStep(1);
+      }
+    } else {
+      light->set_pose(motion->get_pose(s), motion->get_heading(s));
+      light->FinishStep(step_ticks_);
+    }
+    if (ballistic) light->Launch(tick_);
+  }
+}
+
+void Arena::BuildTickGraph() {
+  tick_graph_.Clear();
+  tick_graph_generation_ = generation_;
+
+  // aim for a few chunks per thread so idle threads have work to steal
+  size_t chunks = pool_->get_num_threads() * 4;
+  size_t robot_grain = std::max<size_t>(PARALLEL_MIN_CHUNK,
+    (robot_entities_.size() + chunks - 1) / chunks);
+  size_t light_grain = std::max<size_t>(PARALLEL_MIN_CHUNK,
+    (light_entities_.size() + chunks - 1) / chunks);
+
+  // Robots are visited grouped by the behavior they run, so a chunk holds
+  // a few long runs of one behavior each for BehaviorBatch
+  robot_order_.resize(robot_entities_.size());
+  for (size_t i = 0; i < robot_order_.size(); ++i) robot_order_[i] = i;
+  auto group_of = [this](size_t i) {
+    return robot_entities_[i]->get_motion_handler()->get_behavior()
+      ->get_behavior_enum();
+  };
+  std::stable_sort(robot_order_.begin(), robot_order_.end(),
+    [&group_of](size_t a, size_t b) { return group_of(a) < group_of(b); });
+  behaviors_.Resize(robot_entities_.size());
+
+  // Each chunk does the per-entity work, then integrates all of its poses
+  // in one DifferentialIntegrator pass, then writes them back.
+  robot_motion_.Resize(robot_entities_.size());
+  light_motion_.Resize(light_entities_.size());
+  robot_fixed_motion_.Resize(robot_entities_.size());
+  light_fixed_motion_.Resize(light_entities_.size());
+  light_slot_.resize(light_entities_.size());
+  auto robot_update = tick_graph_.AddRangeTasks(robot_entities_.size(),
+    robot_grain, [this](size_t begin, size_t end) {
+      if (fixed_point_) {
+        MoveRobots(&robot_fixed_motion_, begin, end);
+      } else {
+        MoveRobots(&robot_motion_, begin, end);
+      }
+    });
+  auto light_update = tick_graph_.AddRangeTasks(light_entities_.size(),
+    light_grain, [this](size_t begin, size_t end) {
+      if (fixed_point_) {
+        MoveLights(&light_fixed_motion_, begin, end);
+      } else {
+        MoveLights(&light_motion_, begin, end);
+      }
+    });
+  tick_graph_.AddRangeTasks(food_entities_.size(), food_entities_.size(),
+    [this](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        food_entities_[i]->TimestepUpdate(step_ticks_);
+      }
+    });
+
+  // push data for food entities to robot's food sensors
+  auto food_sense = tick_graph_.AddRangeTasks(robot_entities_.size(),
+    robot_grain, [this](size_t begin, size_t end) {
+      for (size_t k = begin; k < end; ++k) {
+        Robot *rob = robot_entities_[robot_order_[k]];
+        for (auto &ent2 : food_entities_) {
+          rob->get_left_food_sensor()->Notify(ent2->get_pose());
+          rob->get_right_food_sensor()->Notify(ent2->get_pose());
+        }
+      }
+    });
 
   // push data for light entities to robot's light sensors
-  for (auto &ent1 : robot_entities_) {
-    for (auto &ent2 : light_entities_) {
-      ent1->get_left_light_sensor()->Notify(ent2->get_pose());
-      ent1->get_right_light_sensor()->Notify(ent2->get_pose());
-    }  // end inner for
-    for (auto &ent2 : food_entities_) {
-      ent1->get_left_food_sensor()->Notify(ent2->get_pose());
-      ent1->get_right_food_sensor()->Notify(ent2->get_pose());
-    }  // end inner for
-  }  // end outer for
+  auto light_sense = tick_graph_.AddRangeTasks(robot_entities_.size(),
+    robot_grain, [this](size_t begin, size_t end) {
+      for (size_t k = begin; k < end; ++k) {
+        Robot *rob = robot_entities_[robot_order_[k]];
+        for (auto &ent2 : light_entities_) {
+          rob->get_left_light_sensor()->Notify(ent2->get_pose());
+          rob->get_right_light_sensor()->Notify(ent2->get_pose());
+        }
+      }
+    });
+
+  for (size_t c = 0; c < robot_update.size(); c++) {
+    tick_graph_.AddDependency(robot_update[c], food_sense[c]);
+    tick_graph_.AddDependency(robot_update[c], light_sense[c]);
+    tick_graph_.AddDependency(light_update, light_sense[c]);
+  }
 
   /*
    * Check for win/loss
    */
-  for (auto &ent3 : robot_entities_) {
-    bool flag = dynamic_cast<Robot *>(ent3)->get_dead();
-    if (flag)
-      game_status_ = LOST;
+  auto status = tick_graph_.AddTask([this]() {
+    for (auto &ent3 : robot_entities_) {
+      if (ent3->get_dead())
+        game_status_ = LOST;
+    }
+  });
+  tick_graph_.AddDependency(robot_update, status);
+}  // BuildTickGraph()
+
+
+void Arena::UpdateContacts() {
+  if (contact_generation_ != generation_) {
+    next_contact_.assign(mobile_entities_.size(), 0);
+    contact_generation_ = generation_;
   }
+  // adaptive stepping needs the predictions even when nothing is skipped
+  bool predict = event_driven_ || adaptive_step_;
+
+  for (size_t i = 0; i < mobile_entities_.size(); ++i) {
+    ArenaMobileEntity *ent1 = mobile_entities_[i];
+    ++contact_candidates_;
+    if (event_driven_ && next_contact_[i] > tick_) {
+      continue;  // cannot touch anything yet
+    }
+    ++contact_checks_;
+    bool touched = false;
+    double horizon = TicksToWall(ent1);
 
-  /* Determine if any mobile entity is colliding with wall.
-  * Adjust the position accordingly so it doesn't overlap.
-  */
-  for (auto &ent1 : mobile_entities_) {
+    /* Determine if the mobile entity is colliding with wall.
+    * Adjust the position accordingly so it doesn't overlap.
+    */
     EntityType wall = GetCollisionWall(ent1);
     if (kUndefined != wall) {
+      touched = true;
       AdjustWallOverlap(ent1, wall);
       EntityType etype = ent1->get_type();
       if (etype == kRobot) {
@@ -193,7 +552,17 @@ void Arena::UpdateEntitiesTimestep() {
     */
     for (auto &ent2 : entities_) {
       if (ent2 == ent1) { continue; }
+      if (predict) {
+        // a pair with a positive gap cannot be colliding
+        double ticks = TicksToContact(ent1, ent2);
+        if (ticks >= 0) {
+          horizon = std::min(horizon, ticks);
+          continue;
+        }
+        horizon = 0;  // touching, or too close to call
+      }
       if (IsColliding(ent1, ent2)) {
+        touched = true;
         EntityType etype_a = ent1->get_type();
         EntityType etype_b = ent2->get_type();
         AdjustEntityOverlap(ent1, ent2);
@@ -238,9 +607,56 @@ void Arena::UpdateEntitiesTimestep() {
         }  // end else if
       }  // end outer if
     }  // end for
+
+    if (!predict) {
+      continue;
+    }
+    if (touched) {
+      // check again next tick, and since the entity may have been moved,
+      // bring forward anything it could now reach sooner than predicted
+      next_contact_[i] = tick_ + 1;
+      for (size_t k = 0; k < mobile_entities_.size(); ++k) {
+        if (k == i) { continue; }
+        double ticks = TicksToContact(mobile_entities_[k], ent1);
+        unsigned long due = ticks < 0 ? tick_ :
+          tick_ + 1 + static_cast<unsigned long>(ticks);
+        next_contact_[k] = std::min(next_contact_[k], due);
+      }
+    } else {
+      next_contact_[i] = tick_ + 1 +
+        static_cast<unsigned long>(std::max(horizon, 0.0));
+    }
   }  // end outer for
-}  // UpdateEntitiesTimestep()
+}  // UpdateContacts()
+
+double Arena::TicksToContact(ArenaMobileEntity *const ent,
+                             ArenaEntity *const other) const {
+  double delta_x = other->get_pose().x - ent->get_pose().x;
+  double delta_y = other->get_pose().y - ent->get_pose().y;
+  double gap = sqrt(delta_x * delta_x + delta_y * delta_y) -
+    ent->get_radius() - other->get_radius();
+  if (!(gap > kContactSlack)) {
+    return -1;
+  }
+  double closing = ent->get_max_step() + other->get_max_step();
+  if (!(closing > 0)) {
+    return kMaxContactTicks;
+  }
+  return std::min(std::floor((gap - kContactSlack) / closing),
+                  kMaxContactTicks);
+}
 
+double Arena::TicksToWall(ArenaMobileEntity *const ent) const {
+  double step = ent->get_max_step();
+  if (!(step > 0)) {
+    return kMaxContactTicks;
+  }
+  Pose pose = ent->get_pose();
+  double gap = std::min(std::min(pose.x, x_dim_ - pose.x),
+                        std::min(pose.y, y_dim_ - pose.y)) - ent->get_radius();
+  return std::min(std::max(std::floor((gap - kContactSlack) / step), 0.0),
+                  kMaxContactTicks);
+}
 
 // Determine if the entity is colliding with a wall.
 // Always returns an entity type. If not collision, returns kUndefined.
@@ -284,6 +700,13 @@ void Arena::AdjustWallOverlap(ArenaMobileEntity *const ent, EntityType object) {
 bool Arena::IsColliding(
   ArenaMobileEntity * const mobile_e,
   ArenaEntity * const other_e) {
+  if (fixed_point_) {
+    return FixedCirclesTouch(
+      FixedPose(mobile_e->get_pose()),
+      Fixed::FromDouble(mobile_e->get_radius()),
+      FixedPose(other_e->get_pose()),
+      Fixed::FromDouble(other_e->get_radius()));
+  }
   double delta_x = other_e->get_pose().x - mobile_e->get_pose().x;
   double delta_y = other_e->get_pose().y - mobile_e->get_pose().y;
   double distance_between = sqrt(delta_x * delta_x + delta_y * delta_y);
@@ -310,6 +733,29 @@ void Arena::AdjustEntityOverlap(ArenaMobileEntity * const mobile_e,
 
 void Arena::Collide(ArenaMobileEntity * const mobile_e,
                                 ArenaEntity *const other_e) {
+  if (fixed_point_) {
+    // the same push in integers: along the line between the centres, with
+    // an integer square root in place of atan2, cos and sin
+    FixedPose mobile(mobile_e->get_pose());
+    FixedPose other(other_e->get_pose());
+    int64_t delta_x = static_cast<int64_t>(mobile.x.raw()) - other.x.raw();
+    int64_t delta_y = static_cast<int64_t>(mobile.y.raw()) - other.y.raw();
+    int64_t distance = static_cast<int64_t>(IntegerSqrt(
+      static_cast<uint64_t>(delta_x * delta_x + delta_y * delta_y)));
+    if (distance == 0) {
+      // atan2(0, 0) is 0: push along +x
+      delta_x = distance = Fixed::kOne;
+    }
+    int64_t to_move = Fixed::FromDouble(mobile_e->get_radius() +
+                                        other_e->get_radius() + 3).raw() -
+                      distance;
+    mobile_e->set_position(
+      Fixed::FromRaw(mobile.x.raw() + static_cast<int32_t>(
+        to_move * delta_x / distance)).ToDouble(),
+      Fixed::FromRaw(mobile.y.raw() + static_cast<int32_t>(
+        to_move * delta_y / distance)).ToDouble());
+    return;
+  }
   double delta_x = mobile_e->get_pose().x - other_e->get_pose().x;
   double delta_y = mobile_e->get_pose().y - other_e->get_pose().y;
   double distance_between = sqrt(delta_x * delta_x + delta_y * delta_y);
@@ -321,6 +767,18 @@ void Arena::Collide(ArenaMobileEntity * const mobile_e,
     mobile_e->get_pose().y + sin(angle)*distance_to_move);
 }
 
+void Arena::PackState(std::vector<PackedEntityState> *out,
+                      ColorPalette *palette) const {
+  out->clear();
+  out->reserve(entities_.size());
+  for (auto ent : entities_) {
+    if (ent->get_type() == kRobot)
+      out->push_back(PackRobot(*static_cast<Robot *>(ent), palette));
+    else
+      out->push_back(PackEntity(*ent, palette));
+  }
+}
+
 // Accept communication from the controller. Dispatching as appropriate.
 void Arena::AcceptCommand(Communication com) {
   switch (com) {
@@ -336,6 +794,10 @@ void Arena::AcceptCommand(Communication com) {
 } /* AcceptCommand */
 
 void Arena::setLightReading(int num) {
+  // robots added later read the numerator from their profile
+  for (int i = kAggressive; i < kNumRobotBehaviors; i++) {
+    profiles_.at(static_cast<RobotBehaviorEnum>(i)).light_numerator = num;
+  }
   for (unsigned int i = 0; i < robot_entities_.size(); i++) {
     robot_entities_[i]->get_left_light_sensor()->set_numerator(num);
     robot_entities_[i]->get_right_light_sensor()->set_numerator(num);
@@ -371,6 +833,7 @@ void Arena::RemoveLight() {
     }  // end if
 
   factory_->light_count_decrement();  // decrement the light
+  ++generation_;
 
   delete(l_ptr);
 }
@@ -401,6 +864,7 @@ void Arena::RemoveFood() {
     }  // end if
 
   factory_->food_count_decrement();  // decrement the light
+  ++generation_;
 
   delete(f_ptr);
 }
@@ -431,6 +895,8 @@ void Arena::ChangeNumRobot(int num, RobotBehaviorEnum behv) {
       break;
     case kExplore: type_count = factory_->get_explore_robot_count();
       break;
+    case kNeural: type_count = factory_->get_neural_robot_count();
+      break;
     default: type_count = 0;
   }
 
@@ -470,17 +936,11 @@ void Arena::RemoveRobot(RobotBehaviorEnum behv) {
         break;
       }  // end if
 
-    delete(rob->get_left_light_sensor());
-    delete(rob->get_right_light_sensor());
-
-    delete(rob->get_left_food_sensor());
-    delete(rob->get_right_food_sensor());
-
-    delete(rob->get_motion_handler());
-
+    // the robot frees its own sensors and motion handler
     delete(rob);
 
     decrementRobotCount(behv);
+    ++generation_;
   }
 }
 
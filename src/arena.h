@@ -13,15 +13,22 @@
 #include <math.h>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <vector>
 
+#include "src/behavior_batch.h"
 #include "src/common.h"
+#include "src/differential_integrator.h"
+#include "src/fixed_differential_integrator.h"
 #include "src/food.h"
 #include "src/light.h"
 #include "src/entity_factory.h"
+#include "src/entity_view.h"
+#include "src/packed_entity_state.h"
 #include "src/robot.h"
 #include "src/communication.h"
 #include "src/robot_behavior.h"
+#include "src/thread_pool.h"
 
 /*******************************************************************************
  * Namespaces
@@ -56,21 +63,44 @@ class Arena {
   explicit Arena(const struct arena_params *const params);
 
   /**
-   * @brief Arena's destructor. `delete` all entities created.
+   * @brief Arena's destructor. `delete` all entities created and the factory.
+   *
+   * The Arena owns every entity in its vectors; each entity frees whatever
+   * it owns in turn (see MemoryAccounting for the full ownership model).
    */
   ~Arena();
 
   /**
-   * @brief Advance the simulation by the specified # of steps.
+   * @brief Advance the simulation by an amount of time.
+   *
+   * @param[in] dt The time to advance by, in seconds.
+   * @param[in] budget Wall clock seconds the ticks may take, or 0 for no
+   * limit. See StepTicks().
+   *
+   * @return The number of ticks run.
+   *
+   * `dt` is added to the time left over from earlier calls and converted into
+   * whole ticks of TICK_TIME, which are run with StepTicks(). The remainder is
+   * carried to the next call. At most MAX_SUBSTEPS ticks are run per call; if
+   * more are owed the backlog is dropped rather than allowed to grow. Ticks
+   * cut short by the budget are dropped too.
+   *
+   * If `dt <= 0`, `return` immediately.
+   */
+  unsigned long AdvanceTime(double dt, double budget = 0);
+
+  /**
+   * @brief Run a number of ticks back to back.
    *
-   * @param[in] dt The # of steps to increment by. This is
-   * practically unused because the arena state is advanced
-   * incrementally at a fixed rate.
+   * @param[in] ticks The number of ticks to run.
+   * @param[in] budget Wall clock seconds the batch may take, or 0 for no
+   * limit. The batch stops after the first tick that ends past the budget.
    *
-   * If `dt == 0`, `return` immediately. Otherwise calls
-   * Arena::UpdateEntitiesTimestep() once.
+   * @return The number of ticks actually run. This is less than `ticks` only
+   * if the game status changed (e.g. the game was lost) during the batch or
+   * the budget ran out.
    */
-  void AdvanceTime(double dt);
+  unsigned long StepTicks(unsigned long ticks, double budget = 0);
 
   /**
    * @brief adds the robot to the entities_ and mobile_entities_
@@ -115,11 +145,227 @@ class Arena {
   /**
    * @brief Get the Robot vector in Arena.
    *
-   * @return A pointer to the Robot vector.
+   * @return A reference to the Robot vector. No copy is made.
    */
-  std::vector<class Robot *> Robot_Vector() const
+  const std::vector<class Robot *> &Robot_Vector() const
       { return robot_entities_; }
 
+  /**
+   * @brief Read-only view over all entities, mobile and immobile.
+   */
+  EntityView<ArenaEntity> entities() const {
+    return EntityView<ArenaEntity>(entities_.data(), entities_.size(),
+                                   generation_);
+  }
+
+  /**
+   * @brief Read-only view over the robots.
+   */
+  EntityView<Robot> robots() const {
+    return EntityView<Robot>(robot_entities_.data(), robot_entities_.size(),
+                             generation_);
+  }
+
+  /**
+   * @brief Read-only view over the lights.
+   */
+  EntityView<Light> lights() const {
+    return EntityView<Light>(light_entities_.data(), light_entities_.size(),
+                             generation_);
+  }
+
+  /**
+   * @brief Read-only view over the food.
+   */
+  EntityView<Food> foods() const {
+    return EntityView<Food>(food_entities_.data(), food_entities_.size(),
+                            generation_);
+  }
+
+  /**
+   * @brief Read-only view over the entities that can move.
+   */
+  EntityView<ArenaMobileEntity> mobile_entities() const {
+    return EntityView<ArenaMobileEntity>(mobile_entities_.data(),
+                                         mobile_entities_.size(), generation_);
+  }
+
+  /**
+   * @brief Read-only view over all entities of a single type.
+   *
+   * @param type The EntityType to visit (e.g. kLight).
+   */
+  EntityTypeView entities_of_type(EntityType type) const {
+    return EntityTypeView(entities(), type);
+  }
+
+  /**
+   * @brief Get the generation counter of the Arena.
+   *
+   * The counter is incremented every time entities are added, removed or
+   * reset, so a caller holding on to a view (or anything derived from one)
+   * can tell whether it is stale.
+   */
+  unsigned int get_generation() const { return generation_; }
+
+  /**
+   * @brief Get the simulation clock, in ticks since construction or the last
+   * Reset().
+   *
+   * Every timer in the simulation counts ticks of this clock rather than
+   * wall or CPU time, so a run is the same however fast it is stepped.
+   */
+  unsigned long get_tick() const { return tick_; }
+
+  /**
+   * @brief Turn event driven contact checking on or off.
+   *
+   * When on, each mobile entity's earliest possible contact with a wall or
+   * another entity is predicted from the gaps around it and the most every
+   * entity can move in a tick (ArenaEntity::get_max_step()). The entity is
+   * then left out of the contact phase until that tick, so a quiet entity
+   * costs nothing there. Whenever an entity touches something it is checked
+   * every tick again, which is the fixed tick behaviour. The result is the
+   * same with the mode on or off.
+   */
+  void set_event_driven(bool on) { event_driven_ = on; }
+
+  /**
+   * @brief Whether event driven contact checking is on.
+   */
+  bool get_event_driven() const { return event_driven_; }
+
+  /**
+   * @brief Drop every contact prediction, so every mobile entity is checked
+   * on the next tick. Call after moving entities from outside the Arena.
+   */
+  void InvalidateContacts() {
+    contact_generation_ = std::numeric_limits<unsigned int>::max();
+  }
+
+  /**
+   * @brief Mobile entities checked for contacts so far.
+   */
+  unsigned long get_contact_checks() const { return contact_checks_; }
+
+  /**
+   * @brief Mobile entities that would have been checked for contacts so far
+   * with event driven checking off.
+   */
+  unsigned long get_contact_candidates() const { return contact_candidates_; }
+
+  /**
+   * @brief Turn adaptive stepping on or off.
+   *
+   * When on, StepTicks() lets one step cover several ticks while the robots'
+   * wheel velocities change slowly. A step holds every velocity fixed and
+   * moves each entity along the exact arc it gives, so a step of n ticks
+   * costs one round of sensing and velocity updates instead of n.
+   *
+   * n is picked so that 0.5 * a * n^2 stays within the step tolerance, where
+   * a is the fastest change in any robot's wheel velocity per tick between
+   * the last two steps. The velocities follow the sensor readings, so steps
+   * shrink near lights and food, where the readings change fastest. No step
+   * passes an entity's earliest possible contact (see set_event_driven())
+   * or a hunger timer running out; those happen on the same tick they would
+   * with single ticks. An entity in a reverse arc turns every tick, so it
+   * runs the step as single tick substeps of its own instead of shortening
+   * the step for everyone.
+   *
+   * Every step is still a single tick while any entity could touch
+   * something on the next one, and on the first step after the arena
+   * changes, which has no velocity history. Steps therefore only grow in
+   * sparse arenas, where entities are far apart.
+   */
+  void set_adaptive_step(bool on) { adaptive_step_ = on; }
+
+  /**
+   * @brief Whether adaptive stepping is on.
+   */
+  bool get_adaptive_step() const { return adaptive_step_; }
+
+  /**
+   * @brief Set the position error, in arena units, an adaptive step may
+   * introduce. 0 gives single ticks whenever any velocity is changing.
+   */
+  void set_step_tolerance(double tolerance) { step_tolerance_ = tolerance; }
+
+  /**
+   * @brief The adaptive step tolerance.
+   */
+  double get_step_tolerance() const { return step_tolerance_; }
+
+  /**
+   * @brief Set the most ticks one adaptive step may cover.
+   */
+  void set_max_step_ticks(unsigned int ticks) {
+    max_step_ticks_ = std::max(ticks, 1u);
+  }
+
+  /**
+   * @brief Steps taken so far, each one round of sensing and velocity
+   * updates. Equal to the ticks run with adaptive stepping off.
+   */
+  unsigned long get_steps() const { return steps_; }
+
+  /**
+   * @brief Turn ballistic lights on or off.
+   *
+   * Outside its reverse arc a light drives straight at its speed, so its
+   * pose is a closed form of where and when it started cruising (see
+   * Light::Launch()). When on, each cruising light is placed there directly
+   * each step instead of being integrated and updated; only lights that
+   * are turning, or that something has moved, go through the integrator.
+   * Contacts are still predicted as usual, so a light is checked only when
+   * it could touch something (see set_event_driven()). A flight's pose is
+   * computed as origin + ticks * move rather than summed tick by tick, so it
+   * rounds differently from the integrator. Those differences feed back
+   * through sensing and contacts, and a long run ends differently: it
+   * changes results, and is off by default. Ignored in fixed point mode,
+   * which integrates every light in Q16.16.
+   */
+  void set_ballistic_lights(bool on) { ballistic_lights_ = on; }
+
+  /**
+   * @brief Whether ballistic lights are on.
+   */
+  bool get_ballistic_lights() const { return ballistic_lights_; }
+
+  /**
+   * @brief Turn the fixed point physics mode on or off.
+   *
+   * When on, robots and lights move through FixedDifferentialIntegrator and
+   * entity contacts are tested and resolved in Q16.16 integers (see
+   * fixed_point.h), so poses are the same bits on every platform and build
+   * for the same wheel velocities. Positions written by the contact phase
+   * land on the Q16.16 grid as well. Sensing and the behaviors that set the
+   * wheel velocities stay in floating point.
+   */
+  void set_fixed_point(bool on) { fixed_point_ = on; }
+
+  /**
+   * @brief Whether the fixed point physics mode is on.
+   */
+  bool get_fixed_point() const { return fixed_point_; }
+
+  /**
+   * @brief Get the number of threads used for the entity update phase.
+   */
+  unsigned int get_num_threads() const { return pool_->get_num_threads(); }
+
+  /**
+   * @brief Write a compact snapshot of every entity, in entities() order,
+   * e.g. to save or compare arena state. The arena itself keeps stepping
+   * its live entities.
+   *
+   * @param[out] out Cleared and refilled with one PackedEntityState per
+   * entity. Reusing the same vector across calls avoids reallocating.
+   * @param[in,out] palette The palette the colours index; colours not in
+   * it yet are added.
+   */
+  void PackState(std::vector<PackedEntityState> *out,
+                 ColorPalette *palette) const;
+
   /**
    * @brief Under certain circumstance, the compiler requires that the
    * assignment operator is not defined. This `deletes` the default
@@ -175,20 +421,23 @@ class Arena {
 
 
   /**
-   * @brief Update all entities for a single timestep.
+   * @brief Update all entities for a single tick.
    *
-   * First calls each entity's TimestepUpdate method to update their speed,
-   * heading angle, and position. Then check for collisions between entities
-   * or between an entity and a wall.
+   * First runs the tick task graph (see BuildTickGraph()), which calls each
+   * entity's TimestepUpdate method to update their speed, heading angle, and
+   * position, feeds the robots' sensors and checks for a loss. Then check
+   * for collisions between entities or between an entity and a wall.
    */
   void UpdateEntitiesTimestep();
 
   /**
    * @brief Get the ArenaEntities vector in Arena.
    *
-   * @return A pointer to the ArenaEntities vector.
+   * @return A reference to the ArenaEntities vector. No copy is made.
    */
-  std::vector<class ArenaEntity *> get_entities() const { return entities_; }
+  const std::vector<class ArenaEntity *> &get_entities() const {
+    return entities_;
+  }
 
   /**
    * @brief Get the X dimension of the arena.
@@ -240,7 +489,8 @@ class Arena {
   void RemoveLight();
 
   /**
-   * @brief Changes the numerator of the light sensor equation to num
+   * @brief Changes the numerator of the light sensor equation to num, for
+   * current robots and any added later.
    *
    * @param num the new numerator value
    */
@@ -292,6 +542,64 @@ class Arena {
   void RemoveRobot(RobotBehaviorEnum behv);
 
  private:
+  /**
+   * @brief Rebuild tick_graph_ for the current entities.
+   *
+   * Robots and lights are split into chunks. Per chunk of robots, the graph
+   * has an update task (which integrates the chunk's poses in one
+   * DifferentialIntegrator pass), a food sensing task that only waits for that update,
+   * and a light sensing task that also waits for every light update. The
+   * loss check waits for all robot updates. Lights update alongside robots,
+   * and sensing starts as soon as the chunk it reads from is ready.
+   */
+  void BuildTickGraph();
+
+  /**
+   * @brief Advance every entity by `ticks` ticks in one step: run the tick
+   * task graph, then the contact phase.
+   */
+  void Step(unsigned int ticks);
+
+  /**
+   * @brief Ticks the next step of StepTicks() may cover, at most
+   * `remaining`. Always 1 with adaptive stepping off; see
+   * set_adaptive_step().
+   */
+  unsigned int NextStepTicks(unsigned long remaining);
+
+  /**
+   * @brief The robot update of one chunk, [begin, end) of robot_order_:
+   * wheel velocities decided per behavior matrix by behaviors_, then poses
+   * integrated by `motion`.
+   */
+  template <class Integrator>
+  void MoveRobots(Integrator *motion, size_t begin, size_t end);
+
+  /**
+   * @brief The light update of one chunk, [begin, end) of light_entities_,
+   * integrated by `motion`, or placed on their flight if ballistic.
+   */
+  template <class Integrator>
+  void MoveLights(Integrator *motion, size_t begin, size_t end);
+
+  /**
+   * @brief The contact phase of a tick: wall and entity collisions, in
+   * mobile_entities_ order. See set_event_driven().
+   */
+  void UpdateContacts();
+
+  /**
+   * @brief Ticks `ent` and `other` are certain to stay apart for, counted
+   * from the current positions. Negative if they already touch.
+   */
+  double TicksToContact(ArenaMobileEntity *const ent,
+                        ArenaEntity *const other) const;
+
+  /**
+   * @brief Ticks `ent` is certain to stay clear of every wall for.
+   */
+  double TicksToWall(ArenaMobileEntity *const ent) const;
+
   // Dimensions of graphics window inside which entities must operate
   double x_dim_;
   double y_dim_;
@@ -299,6 +607,31 @@ class Arena {
   // Used to create all entities within the arena
   EntityFactory *factory_;
 
+  // Configuration of this arena's robots, built from arena_params
+  RobotProfileTable profiles_;
+
+  // Runs the per-entity update phase in parallel
+  ThreadPool *pool_;
+
+  // The parallel part of a tick, rebuilt when the generation changes
+  TaskGraph tick_graph_;
+  unsigned int tick_graph_generation_;
+
+  // Pose integration for robots and lights, one slot per entity
+  DifferentialIntegrator robot_motion_;
+  DifferentialIntegrator light_motion_;
+  // The same in fixed point, used instead when fixed_point_ is set
+  FixedDifferentialIntegrator robot_fixed_motion_;
+  FixedDifferentialIntegrator light_fixed_motion_;
+  // The light behind each light integrator slot; a chunk packs the lights
+  // it integrates into the front of its own slots
+  std::vector<size_t> light_slot_;
+
+  // The order robot chunks visit robot_entities_ in, grouped by behavior,
+  // and their velocity calculation
+  std::vector<size_t> robot_order_;
+  BehaviorBatch behaviors_;
+
   // Robot is special. It's also stored in the entity vectors.
   Robot *robot_{nullptr};
 
@@ -324,6 +657,38 @@ class Arena {
 
   // win/lose/playing state
   int game_status_;
+
+  // Bumped whenever the contents of the entity vectors change
+  unsigned int generation_;
+  unsigned long tick_;
+  // simulated time not yet consumed by a whole tick
+  double time_remainder_;
+
+  // Event driven contact checking: the first tick each mobile entity must be
+  // checked on, in mobile_entities_ order, and the generation it is for
+  bool event_driven_;
+  std::vector<unsigned long> next_contact_;
+  unsigned int contact_generation_;
+  unsigned long contact_checks_;
+  unsigned long contact_candidates_;
+
+  // Adaptive stepping: the ticks the running step covers, each robot's
+  // wheel velocity when the controller last looked (robot_entities_ order)
+  // with the tick it was evaluated on, and the generation they are for
+  bool adaptive_step_;
+  double step_tolerance_;
+  unsigned int max_step_ticks_;
+  unsigned int step_ticks_;
+  std::vector<WheelVelocity> step_velocity_;
+  unsigned long velocity_tick_;
+  unsigned int step_generation_;
+  unsigned long steps_;
+
+  // Lights cruising in a straight line are placed, not integrated
+  bool ballistic_lights_;
+
+  // Fixed point physics mode
+  bool fixed_point_;
 };
 
 NAMESPACE_END(csci3081);
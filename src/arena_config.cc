@@ -0,0 +1,233 @@
+/**
+ * @file arena_config.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "src/arena_config.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+// Strip leading and trailing whitespace.
+static std::string Trim(const std::string &text) {
+  size_t first = text.find_first_not_of(" \t\r\n");
+  if (first == std::string::npos) return "";
+  size_t last = text.find_last_not_of(" \t\r\n");
+  return text.substr(first, last - first + 1);
+}
+
+// Parse "R,G,B" into a colour.
+static bool ParseColor(const std::string &text, RgbColor *color) {
+  char *end = nullptr;
+  const char *p = text.c_str();
+  long r = std::strtol(p, &end, 10);
+  if (end == p || *end != ',') return false;
+  p = end + 1;
+  long g = std::strtol(p, &end, 10);
+  if (end == p || *end != ',') return false;
+  p = end + 1;
+  long b = std::strtol(p, &end, 10);
+  if (end == p || !Trim(end).empty()) return false;
+  *color = RgbColor(static_cast<int>(r), static_cast<int>(g),
+                    static_cast<int>(b));
+  return true;
+}
+
+// The colour field with this name, or nullptr.
+static RgbColor *ColorField(const std::string &name,
+                            struct arena_params *params) {
+  if (name == "robot_color") return &params->robot_color;
+  if (name == "fear_color") return &params->fear_color;
+  if (name == "aggressive_color") return &params->aggressive_color;
+  if (name == "explore_color") return &params->explore_color;
+  if (name == "love_color") return &params->love_color;
+  if (name == "neural_color") return &params->neural_color;
+  if (name == "light_color") return &params->light_color;
+  if (name == "food_color") return &params->food_color;
+  return nullptr;
+}
+
+// The behavior matrix field with this name, or nullptr.
+static BehaviorMatrix *MatrixField(const std::string &name,
+                                   struct arena_params *params) {
+  if (name == "fear_matrix") return &params->fear_matrix;
+  if (name == "aggressive_matrix") return &params->aggressive_matrix;
+  if (name == "explore_matrix") return &params->explore_matrix;
+  if (name == "love_matrix") return &params->love_matrix;
+  return nullptr;
+}
+
+// Set weight K of the matrix named "<behavior>_matrix.K", counting in the
+// order ParseBehaviorMatrix() reads them.
+static bool SetMatrixWeight(const std::string &name, double value,
+                            struct arena_params *params) {
+  size_t dot = name.find('.');
+  if (dot == std::string::npos) return false;
+  BehaviorMatrix *matrix = MatrixField(name.substr(0, dot), params);
+  const char *index = name.c_str() + dot + 1;
+  char *end = nullptr;
+  unsigned long k = std::strtoul(index, &end, 10);
+  if (matrix == nullptr || end == index || *end != '\0' ||
+      k >= 2 * (kBehaviorInputs + 1)) {
+    return false;
+  }
+  matrix->weights[k / (kBehaviorInputs + 1)][k % (kBehaviorInputs + 1)] =
+    value;
+  return true;
+}
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+bool SetArenaParamValue(const std::string &name, double value,
+                        struct arena_params *params) {
+  long whole = std::lround(value);
+  size_t count = whole > 0 ? static_cast<size_t>(whole) : 0;
+  unsigned int uvalue = static_cast<unsigned int>(count);
+  if (name == "width") {
+    params->x_dim = uvalue;
+  } else if (name == "height") {
+    params->y_dim = uvalue;
+  } else if (name == "threads") {
+    params->n_threads = uvalue;
+  } else if (name == "seed") {
+    params->seed = uvalue;
+  } else if (name == "event_driven") {
+    params->event_driven = whole != 0;
+  } else if (name == "adaptive_step") {
+    params->adaptive_step = whole != 0;
+  } else if (name == "step_tolerance") {
+    params->step_tolerance = value;
+  } else if (name == "max_step_ticks") {
+    params->max_step_ticks = uvalue;
+  } else if (name == "ballistic_lights") {
+    params->ballistic_lights = whole != 0;
+  } else if (name == "fixed_point") {
+    params->fixed_point = whole != 0;
+  } else if (name == "lights") {
+    params->n_lights = count;
+  } else if (name == "foods") {
+    params->n_foods = count;
+  } else if (name == "fear") {
+    params->n_fear_robots = count;
+  } else if (name == "aggressive") {
+    params->n_aggressive_robots = count;
+  } else if (name == "explore") {
+    params->n_explore_robots = count;
+  } else if (name == "love") {
+    params->n_love_robots = count;
+  } else if (name == "neural") {
+    params->n_neural_robots = count;
+  } else if (name == "hunger") {
+    params->robot_hunger = value;
+  } else if (name == "starve") {
+    params->robot_starve = value;
+  } else if (name == "death") {
+    params->robot_death = value;
+  } else if (name == "max_sens") {
+    params->max_sens = value;
+  } else if (name == "numerator") {
+    params->light_numerator = static_cast<int>(whole);
+  } else if (name == "food_numerator") {
+    params->food_numerator = static_cast<int>(whole);
+  } else if (name == "robot_min_radius") {
+    params->robot_min_radius = value;
+  } else if (name == "robot_max_radius") {
+    params->robot_max_radius = value;
+  } else if (name == "robot_max_speed") {
+    params->robot_max_speed = value;
+  } else if (name == "robot_max_angle") {
+    params->robot_max_angle = value;
+  } else if (name == "arc_ticks") {
+    params->arc_ticks = uvalue;
+  } else if (name == "light_min_radius") {
+    params->light_min_radius = value;
+  } else if (name == "light_max_radius") {
+    params->light_max_radius = value;
+  } else if (name == "light_speed") {
+    params->light_speed = value;
+  } else if (name == "food_radius") {
+    params->food_radius = value;
+  } else {
+    return SetMatrixWeight(name, value, params);
+  }
+  return true;
+}
+
+bool SetArenaParam(const std::string &name, const std::string &value,
+                   struct arena_params *params) {
+  RgbColor *color = ColorField(name, params);
+  if (color != nullptr) return ParseColor(value, color);
+  BehaviorMatrix *matrix = MatrixField(name, params);
+  if (matrix != nullptr) return ParseBehaviorMatrix(value, matrix);
+  if (name == "neural_weights") {
+    std::string path = Trim(value);
+    if (!LoadNeuralNetwork(path, &params->neural_network)) return false;
+    params->neural_weights = path;
+    return true;
+  }
+
+  std::string text = Trim(value);
+  char *end = nullptr;
+  double number = std::strtod(text.c_str(), &end);
+  if (text.empty() || *end != '\0') return false;
+  return SetArenaParamValue(name, number, params);
+}
+
+bool LoadArenaParams(const std::string &path, struct arena_params *params,
+                     std::string *error) {
+  std::ifstream in(path);
+  if (!in) {
+    if (error != nullptr) *error = "cannot open " + path;
+    return false;
+  }
+  std::string line;
+  int line_no = 0;
+  while (std::getline(in, line)) {
+    ++line_no;
+    line = Trim(line.substr(0, line.find('#')));
+    if (line.empty()) continue;
+    size_t eq = line.find('=');
+    if (eq == std::string::npos ||
+        !SetArenaParam(Trim(line.substr(0, eq)), line.substr(eq + 1),
+                       params)) {
+      if (error != nullptr) {
+        std::ostringstream msg;
+        msg << path << ":" << line_no << ": bad setting \"" << line << "\"";
+        *error = msg.str();
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CheckArenaParams(const struct arena_params &params,
+                      std::string *error) {
+  if (params.n_neural_robots > 0 && params.neural_weights.empty()) {
+    if (error != nullptr) {
+      std::ostringstream msg;
+      msg << "neural=" << params.n_neural_robots
+          << " needs a network: set neural_weights=FILE";
+      *error = msg.str();
+    }
+    return false;
+  }
+  return true;
+}
+
+NAMESPACE_END(csci3081);
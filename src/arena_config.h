@@ -0,0 +1,94 @@
+/**
+ * @file arena_config.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_ARENA_CONFIG_H_
+#define SRC_ARENA_CONFIG_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+
+#include "src/arena_params.h"
+#include "src/common.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief Set a numeric field of an arena_params by name.
+ *
+ * Names are: width, height, threads, seed, event_driven, adaptive_step,
+ * step_tolerance, max_step_ticks, ballistic_lights, fixed_point, lights,
+ * foods, fear, aggressive, explore, love, neural, hunger, starve, death,
+ * max_sens, numerator,
+ * food_numerator, robot_min_radius, robot_max_radius, robot_max_speed,
+ * robot_max_angle, arc_ticks, light_min_radius, light_max_radius,
+ * light_speed and food_radius, and the single weights of the behavior
+ * matrices, written fear_matrix.K (and so on) for K from 0 to 11 in the
+ * order of ParseBehaviorMatrix().
+ * Whole number fields are rounded, and negative counts become 0.
+ *
+ * @return false if the name is not a numeric field.
+ */
+bool SetArenaParamValue(const std::string &name, double value,
+                        struct arena_params *params);
+
+/**
+ * @brief Set any field of an arena_params from text.
+ *
+ * Accepts the names of SetArenaParamValue() and the colours robot_color,
+ * fear_color, aggressive_color, explore_color, love_color, neural_color,
+ * light_color and food_color, written as "R,G,B", the behaviors fear_matrix,
+ * aggressive_matrix, explore_matrix and love_matrix, written as in
+ * ParseBehaviorMatrix(), and neural_weights, the path of a weights file for
+ * LoadNeuralNetwork().
+ *
+ * @return false if the name is unknown or the value does not parse.
+ */
+bool SetArenaParam(const std::string &name, const std::string &value,
+                   struct arena_params *params);
+
+/**
+ * @brief Load a scenario file into an arena_params.
+ *
+ * The file holds one `name = value` pair per line, with the names accepted by
+ * SetArenaParam(). Blank lines and anything after a `#` are ignored. Fields
+ * the file does not mention keep their current value, so command line
+ * overrides can be applied afterwards.
+ *
+ * @param[in] path The file to read.
+ * @param[out] params The parameters to update.
+ * @param[out] error If not null, set to a description of the first problem.
+ *
+ * @return false if the file cannot be read or a line is invalid.
+ */
+bool LoadArenaParams(const std::string &path, struct arena_params *params,
+                     std::string *error = nullptr);
+
+/**
+ * @brief Check that the settings of an arena_params fit together.
+ *
+ * Neural robots have no network unless one is loaded, so `neural` above 0
+ * requires `neural_weights`. A scenario file and the command line may each
+ * give half of such a pair, so check once every setting has been applied.
+ *
+ * @param[in] params The parameters to check.
+ * @param[out] error If not null, set to a description of the first problem.
+ *
+ * @return false if the settings do not fit together.
+ */
+bool CheckArenaParams(const struct arena_params &params,
+                      std::string *error = nullptr);
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_ARENA_CONFIG_H_
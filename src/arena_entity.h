@@ -10,6 +10,7 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cmath>
 #include <string>
 
 #include "src/common.h"
@@ -49,7 +50,9 @@ class ArenaEntity {
   /**
   * @brief ArenaEntity constructor initialized with default values from params.h
   */
-  ArenaEntity() : pose_(DEFAULT_POSE), color_(DEFAULT_COLOR) {}
+  ArenaEntity() : pose_(DEFAULT_POSE),
+                  heading_(Heading::FromDegrees(pose_.theta)),
+                  color_(DEFAULT_COLOR) {}
 
   /**
    * @brief Default destructor -- as defined by compiler.
@@ -84,12 +87,34 @@ class ArenaEntity {
    */
   const Pose &get_pose() const { return pose_; }
 
+  /**
+   * @brief Get the heading of the entity in radians, with its unit vector.
+   * Always agrees with get_pose().theta, which is in degrees.
+   */
+  const Heading &get_heading() const { return heading_; }
+
    /**
    * @brief Setter for the pose of the entity
    *
    * @param[in] pose modifies the pose of the entity
    */  
-  void set_pose(const Pose &pose) { pose_ = pose; }
+  void set_pose(const Pose &pose) {
+    pose_ = pose;
+    SyncHeading();
+  }
+
+  /**
+   * @brief Setter for the pose of the entity when the caller already has the
+   * matching Heading (for instance from DifferentialIntegrator), which
+   * saves evaluating sin and cos again.
+   *
+   * @param[in] pose the new pose
+   * @param[in] heading the heading for pose.theta
+   */
+  void set_pose(const Pose &pose, const Heading &heading) {
+    pose_ = pose;
+    heading_ = heading;
+  }
 
   /**
    * @brief Setter method for position within entity pose variable.
@@ -102,7 +127,10 @@ class ArenaEntity {
   /**
    * @brief Setter method for heading within entity pose variable.
    */
-  void set_heading(const double t) {pose_.theta = t;}
+  void set_heading(const double t) {
+    pose_.theta = t;
+    SyncHeading();
+  }
 
   /**
    * @brief Setter for heading within pose, but change is relative to current
@@ -113,6 +141,7 @@ class ArenaEntity {
    */
   void RelativeChangeHeading(const double delta) {
     pose_.theta += delta;
+    SyncHeading();
   }
 
   /**
@@ -182,17 +211,22 @@ class ArenaEntity {
   void set_mobility(bool value) { is_mobile_ = value; }
 
   /**
-  * @brief An attempt to not overlap any of the newly constructed entities.
-  */
-  Pose SetPoseRandomlyAux() {
-    // Dividing arena into 19x14 grid. Each grid square is 50x50
-    return {static_cast<double>((30 + (random() % 19) * 50)),
-            static_cast<double>((30 + (random() % 14) * 50))};
-  }
+   * @brief Upper bound on the distance the entity moves in one tick.
+   *
+   * The Arena uses it to predict the earliest tick the entity can touch
+   * anything. Immobile entities return 0; mobile entities that cannot bound
+   * their motion return HUGE_VAL and are checked every tick.
+   */
+  virtual double get_max_step() const { return is_mobile_ ? HUGE_VAL : 0; }
 
  private:
+  // The one place heading_ is derived from pose_.theta.
+  void SyncHeading() { heading_ = Heading::FromDegrees(pose_.theta); }
+
   double radius_{DEFAULT_RADIUS};
   Pose pose_;
+  // pose_.theta in radians, with its unit vector
+  Heading heading_;
   RgbColor color_;
   EntityType type_{kEntity};
   int id_{ -1};
@@ -47,6 +47,11 @@ class ArenaMobileEntity : public ArenaEntity {
     set_mobility(true);
   }
 
+  /**
+   * @brief Destructor. `delete` the touch sensor owned by the entity.
+   */
+  ~ArenaMobileEntity() override { delete sensor_touch_; }
+
   ArenaMobileEntity(const ArenaMobileEntity& other) = delete;
   ArenaMobileEntity& operator=(const ArenaMobileEntity& other) = delete;
 
@@ -55,7 +60,7 @@ class ArenaMobileEntity : public ArenaEntity {
    *
    * @param[out] returns the speed of the entity
    */
-  virtual double get_speed() { return speed_; }
+  virtual double get_speed() const { return speed_; }
 
   /**
    * @brief Setter for the speed of the entity
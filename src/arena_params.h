@@ -11,9 +11,14 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstddef>
+#include <string>
+
+#include "src/behavior_matrix.h"
 #include "src/common.h"
-#include "src/light.h"
+#include "src/neural_network.h"
 #include "src/params.h"
+#include "src/rgb_color.h"
 
 /*******************************************************************************
  * Namespaces
@@ -27,7 +32,9 @@ NAMESPACE_BEGIN(csci3081);
 * @brief Struct holding parameters for initializing the Arena.
 *
 * These parameters include the parameters for Arena's geometry as well as the
-* parameters for initializing ALL entities within the Arena.
+* parameters for initializing ALL entities within the Arena. Every field
+* defaults to its params.h macro and can be changed at run time, see
+* LoadArenaParams() in arena_config.h.
 */
 struct arena_params {
   size_t n_lights{N_LIGHTS};
@@ -36,8 +43,52 @@ struct arena_params {
   size_t n_aggressive_robots{ROBOT_AGGRESSIVE};
   size_t n_explore_robots{ROBOT_EXPLORE};
   size_t n_love_robots{ROBOT_LOVE};
+  size_t n_neural_robots{ROBOT_NEURAL};
   uint x_dim{ARENA_X_DIM};
   uint y_dim{ARENA_Y_DIM};
+  unsigned int n_threads{N_THREADS};
+  unsigned int seed{ARENA_SEED};
+  bool event_driven{EVENT_DRIVEN != 0};
+  bool adaptive_step{ADAPTIVE_STEP != 0};
+  double step_tolerance{STEP_TOLERANCE};
+  unsigned int max_step_ticks{MAX_STEP_TICKS};
+  bool ballistic_lights{BALLISTIC_LIGHTS != 0};
+  bool fixed_point{FIXED_POINT != 0};
+  // robot tunables; every behavior shares them
+  double robot_hunger{ROBOT_HUNGER};
+  double robot_starve{ROBOT_STARVE};
+  double robot_death{ROBOT_DEATH};
+  double max_sens{MAX_SENS};
+  int light_numerator{MAX_NUMERATOR};
+  int food_numerator{MAX_NUMERATOR};
+  double robot_min_radius{ROBOT_MIN_RADIUS};
+  double robot_max_radius{ROBOT_MAX_RADIUS};
+  double robot_max_speed{ROBOT_MAX_SPEED};
+  double robot_max_angle{ROBOT_MAX_ANGLE};
+  // length of the reverse arc after a collision, robots and lights alike
+  unsigned int arc_ticks{ARC_TICKS};
+  // light and food tunables
+  double light_min_radius{OBSTACLE_MIN_RADIUS};
+  double light_max_radius{OBSTACLE_MAX_RADIUS};
+  double light_speed{LIGHT_SPEED};
+  double food_radius{FOOD_RADIUS};
+  // colours
+  RgbColor robot_color = ROBOT_COLOR;
+  RgbColor fear_color = FEAR_COLOR;
+  RgbColor aggressive_color = AGGRESSIVE_COLOR;
+  RgbColor explore_color = EXPLORE_COLOR;
+  RgbColor love_color = LOVE_COLOR;
+  RgbColor neural_color = NEURAL_COLOR;
+  RgbColor light_color = OBSTACLE_COLOR;
+  RgbColor food_color = FOOD_COLOR;
+  // behaviors
+  BehaviorMatrix fear_matrix = kFearMatrix;
+  BehaviorMatrix aggressive_matrix = kAggressiveMatrix;
+  BehaviorMatrix explore_matrix = kExploreMatrix;
+  BehaviorMatrix love_matrix = kLoveMatrix;
+  NeuralNetwork neural_network{};
+  // the weights file neural_network was loaded from, empty if none was
+  std::string neural_weights{};
 };
 
 NAMESPACE_END(csci3081);
@@ -0,0 +1,147 @@
+/**
+ * @file behavior_batch.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+
+#include "src/behavior_batch.h"
+#include "src/robot.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void BehaviorBatch::Resize(size_t n) {
+  light_left_.resize(n);
+  light_right_.resize(n);
+  food_left_.resize(n);
+  food_right_.resize(n);
+  hungry_.resize(n);
+  starving_.resize(n);
+  max_sens_.resize(n);
+  matrix_.resize(n);
+  network_.resize(n);
+  velocity_.resize(n);
+}
+
+void BehaviorBatch::Load(size_t i, Robot *rob) {
+  light_left_[i] = rob->get_left_light_sensor()->get_reading();
+  light_right_[i] = rob->get_right_light_sensor()->get_reading();
+  food_left_[i] = rob->get_left_food_sensor()->get_reading();
+  food_right_[i] = rob->get_right_food_sensor()->get_reading();
+  hungry_[i] = rob->get_is_hungry() ? 1 : 0;
+  starving_[i] = rob->get_is_starving() ? 1 : 0;
+  const RobotBehavior *behavior = rob->get_motion_handler()->get_behavior();
+  max_sens_[i] = behavior->get_max_sens();
+  matrix_[i] = behavior->get_matrix();
+  network_[i] = behavior->get_network();
+}
+
+void BehaviorBatch::Run(const BehaviorMatrix &matrix, size_t begin,
+                        size_t end) {
+  const double *light_left = light_left_.data();
+  const double *light_right = light_right_.data();
+  const double *food_left = food_left_.data();
+  const double *food_right = food_right_.data();
+  const double *hungry = hungry_.data();
+  const double *starving = starving_.data();
+  const double *max_sens = max_sens_.data();
+  WheelVelocity *velocity = velocity_.data();
+  // locals, so the loop need not reload them after each store
+  const double *l = matrix.weights[0], *r = matrix.weights[1];
+  const double l0 = l[0], l1 = l[1], l2 = l[2], l3 = l[3], l4 = l[4];
+  const double l5 = l[5];
+  const double r0 = r[0], r1 = r[1], r2 = r[2], r3 = r[3], r4 = r[4];
+  const double r5 = r[5];
+
+  for (size_t i = begin; i < end; ++i) {
+    // every input is read up front, so the selects below need no branches
+    double ll = light_left[i], lr = light_right[i], ms = max_sens[i];
+    double food_l = food_left[i], food_r = food_right[i];
+    double fl = hungry[i] > 0 ? food_l : 0;
+    double fr = hungry[i] > 0 ? food_r : 0;
+    // the same sums, in the same order, as BehaviorMatrix::Row()
+    double left = l0 * fl + l1 * fr + l2 * ms + l3 * ll + l4 * lr + l5;
+    double right = r0 * fl + r1 * fr + r2 * ms + r3 * ll + r4 * lr + r5;
+    velocity[i].left = starving[i] > 0 ? 0.4 * food_r : left;
+    velocity[i].right = starving[i] > 0 ? 0.4 * food_l : right;
+  }
+}
+
+void BehaviorBatch::RunNetwork(const NeuralNetwork &net, size_t begin,
+                               size_t end) {
+  // slots per block: wide enough to fill the vector units, small enough
+  // that a block's hidden activations stay in L1
+  constexpr size_t kBlock = 32;
+  const size_t hidden = net.hidden;
+  // zeroed so the tail of a short last block computes on set values
+  double in[kBehaviorInputs][kBlock] = {};
+  double act[kMaxHiddenUnits][kBlock];
+  double out[2][kBlock];
+
+  for (size_t first = begin; first < end; first += kBlock) {
+    size_t n = std::min(kBlock, end - first);
+    for (size_t j = 0; j < n; ++j) {
+      size_t i = first + j;
+      double fl = food_left_[i], fr = food_right_[i];
+      in[kFoodLeftInput][j] = hungry_[i] > 0 ? fl : 0;
+      in[kFoodRightInput][j] = hungry_[i] > 0 ? fr : 0;
+      in[kMaxSensInput][j] = max_sens_[i];
+      in[kLightLeftInput][j] = light_left_[i];
+      in[kLightRightInput][j] = light_right_[i];
+    }
+    // hidden = softsign(W * in + b), summed as in NeuralNetwork::Apply()
+    for (size_t h = 0; h < hidden; ++h) {
+      const double *w = net.hidden_row(h);
+      double *a = act[h];
+      for (size_t j = 0; j < kBlock; ++j) a[j] = w[kBehaviorInputs];
+      for (int k = 0; k < kBehaviorInputs; ++k) {
+        const double wk = w[k];
+        for (size_t j = 0; j < kBlock; ++j) a[j] += wk * in[k][j];
+      }
+      for (size_t j = 0; j < kBlock; ++j) a[j] = Softsign(a[j]);
+    }
+    // out = V * hidden + c
+    for (int wheel = 0; wheel < 2; ++wheel) {
+      const double *w = net.output_row(wheel);
+      double *o = out[wheel];
+      for (size_t j = 0; j < kBlock; ++j) o[j] = w[hidden];
+      for (size_t h = 0; h < hidden; ++h) {
+        const double wh = w[h];
+        for (size_t j = 0; j < kBlock; ++j) o[j] += wh * act[h][j];
+      }
+    }
+    for (size_t j = 0; j < n; ++j) {
+      size_t i = first + j;
+      velocity_[i].left = starving_[i] > 0 ? 0.4 * food_right_[i] : out[0][j];
+      velocity_[i].right = starving_[i] > 0 ? 0.4 * food_left_[i] : out[1][j];
+    }
+  }
+}
+
+void BehaviorBatch::Decide(size_t begin, size_t end) {
+  for (size_t run = begin; run < end;) {
+    size_t stop = run + 1;
+    while (stop < end && matrix_[stop] == matrix_[run] &&
+           network_[stop] == network_[run]) {
+      ++stop;
+    }
+    if (network_[run] != nullptr) {
+      RunNetwork(*network_[run], run, stop);
+    } else {
+      Run(*matrix_[run], run, stop);
+    }
+    run = stop;
+  }
+}
+
+NAMESPACE_END(csci3081);
@@ -0,0 +1,107 @@
+/**
+ * @file behavior_batch.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_BEHAVIOR_BATCH_H_
+#define SRC_BEHAVIOR_BATCH_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "src/behavior_matrix.h"
+#include "src/common.h"
+#include "src/neural_network.h"
+#include "src/wheel_velocity.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+class Robot;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Computes the wheel velocities of many robots at once, one behavior
+ * matrix or network at a time.
+ *
+ * Sensor readings, hunger flags and wheel biases are held in separate
+ * contiguous arrays, one slot per robot, along with the BehaviorMatrix or
+ * NeuralNetwork each robot runs. Decide() splits a range of slots into runs
+ * that share a controller and evaluates each run together. A matrix run is
+ * one loop over the slots: the weights are read once per run, and the loop
+ * itself has no virtual calls or branches, only arithmetic and selects, so
+ * it can be vectorised. A network run goes a block of slots at a time,
+ * each layer a matrix-matrix product of the weights with the block's
+ * inputs, with the innermost loops over the block. Starving robots head for
+ * food whatever their behavior, as in MotionHandlerRobot::UpdateVelocity().
+ *
+ * The velocities are the ones RobotBehavior::Movement() gives, bit for bit,
+ * before MotionHandlerRobot clamps them.
+ *
+ * Ranges of slots can be loaded, decided and read from different threads as
+ * long as the ranges do not overlap.
+ */
+class BehaviorBatch {
+ public:
+  BehaviorBatch()
+    : light_left_(), light_right_(), food_left_(), food_right_(), hungry_(),
+      starving_(), max_sens_(), matrix_(), network_(), velocity_() {}
+
+  /**
+   * @brief Set the number of slots.
+   */
+  void Resize(size_t n);
+
+  /**
+   * @brief Number of slots.
+   */
+  size_t size() const { return velocity_.size(); }
+
+  /**
+   * @brief Load one robot's sensor readings, hunger flags, wheel bias and
+   * behavior matrix or network into a slot.
+   */
+  void Load(size_t i, Robot *rob);
+
+  /**
+   * @brief Compute the velocities of slots [begin, end). Neighbouring
+   * slots with the same controller are done together, so the range is best
+   * loaded grouped by behavior.
+   */
+  void Decide(size_t begin, size_t end);
+
+  /**
+   * @brief The velocity computed for a slot.
+   */
+  WheelVelocity get_velocity(size_t i) const { return velocity_[i]; }
+
+ private:
+  void Run(const BehaviorMatrix &matrix, size_t begin, size_t end);
+  void RunNetwork(const NeuralNetwork &net, size_t begin, size_t end);
+
+  std::vector<double> light_left_;
+  std::vector<double> light_right_;
+  std::vector<double> food_left_;
+  std::vector<double> food_right_;
+  // flags as 0 or 1, the width of the readings, so one loop can hold both
+  std::vector<double> hungry_;
+  std::vector<double> starving_;
+  std::vector<double> max_sens_;
+  std::vector<const BehaviorMatrix *> matrix_;
+  // nullptr where the robot runs its matrix
+  std::vector<const NeuralNetwork *> network_;
+  // one output array rather than two keeps the run time overlap checks
+  // the compiler needs before vectorising under its limit
+  std::vector<WheelVelocity> velocity_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_BEHAVIOR_BATCH_H_
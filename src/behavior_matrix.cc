@@ -0,0 +1,41 @@
+/**
+ * @file behavior_matrix.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cctype>
+#include <cstdlib>
+
+#include "src/behavior_matrix.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+bool ParseBehaviorMatrix(const std::string &text, BehaviorMatrix *matrix) {
+  BehaviorMatrix parsed = BehaviorMatrix();
+  const char *p = text.c_str();
+  for (int k = 0; k < 2 * (kBehaviorInputs + 1); ++k) {
+    char *end = nullptr;
+    double value = std::strtod(p, &end);
+    if (end == p) return false;
+    parsed.weights[k / (kBehaviorInputs + 1)][k % (kBehaviorInputs + 1)] =
+      value;
+    while (std::isspace(static_cast<unsigned char>(*end))) ++end;
+    bool last = k == 2 * (kBehaviorInputs + 1) - 1;
+    if (last ? *end != '\0' : *end != ',') return false;
+    p = end + 1;
+  }
+  *matrix = parsed;
+  return true;
+}
+
+NAMESPACE_END(csci3081);
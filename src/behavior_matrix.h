@@ -0,0 +1,107 @@
+/**
+ * @file behavior_matrix.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_BEHAVIOR_MATRIX_H_
+#define SRC_BEHAVIOR_MATRIX_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+
+#include "src/common.h"
+#include "src/wheel_velocity.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/**
+ * @brief The inputs of a BehaviorMatrix, in the order they are summed.
+ *
+ * The food readings only count while the robot is hungry; the wheel bias is
+ * the robot's max_sens.
+ */
+enum BehaviorInput {
+  kFoodLeftInput, kFoodRightInput, kMaxSensInput, kLightLeftInput,
+  kLightRightInput, kBehaviorInputs
+};
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief A linear Braitenberg behavior: each wheel speed is a weighted sum
+ * of the sensor readings plus a bias.
+ *
+ * Row 0 drives the left wheel and row 1 the right. Each row holds one
+ * weight per BehaviorInput, then the bias. The sum is taken in input order,
+ * so the presets below give exactly what the original behavior classes
+ * computed. New behaviors are new matrices; see ParseBehaviorMatrix() for
+ * loading one.
+ */
+struct BehaviorMatrix {
+  double weights[2][kBehaviorInputs + 1];
+
+  /**
+   * @brief The wheel speeds for one set of readings, before clamping.
+   */
+  WheelVelocity Apply(double light_left, double light_right,
+                      double food_left, double food_right, bool hungry,
+                      double max_sens) const {
+    const double in[kBehaviorInputs] = {
+      hungry ? food_left : 0, hungry ? food_right : 0, max_sens, light_left,
+      light_right};
+    return WheelVelocity(Row(0, in), Row(1, in));
+  }
+
+  /**
+   * @brief Row `wheel` applied to `in`, summed in input order.
+   */
+  double Row(int wheel, const double *in) const {
+    const double *w = weights[wheel];
+    double sum = w[0] * in[0];
+    for (int k = 1; k < kBehaviorInputs; ++k) sum += w[k] * in[k];
+    return sum + w[kBehaviorInputs];
+  }
+};
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+// Both wheels follow hunger with the crossed food readings. Fear drives
+// each wheel from the light on its own side, so it turns away from light;
+// aggressive crosses them and turns toward it. Explore and love subtract
+// the light from the wheel bias, crossed and uncrossed respectively.
+constexpr BehaviorMatrix kFearMatrix{{
+  {0, 0.5, 0, 0.5, 0, 0},
+  {0.5, 0, 0, 0, 0.5, 0}}};
+constexpr BehaviorMatrix kAggressiveMatrix{{
+  {0, 0.5, 0, 0, 0.5, 0},
+  {0.5, 0, 0, 0.5, 0, 0}}};
+constexpr BehaviorMatrix kExploreMatrix{{
+  {0, 0.5, 1, 0, -0.5, 0},
+  {0.5, 0, 1, -0.5, 0, 0}}};
+constexpr BehaviorMatrix kLoveMatrix{{
+  {0, 0.5, 1, -0.5, 0, 0},
+  {0.5, 0, 1, 0, -0.5, 0}}};
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief Parse a BehaviorMatrix from twelve numbers separated by commas:
+ * the left wheel's five weights (in BehaviorInput order) and bias, then the
+ * right wheel's.
+ *
+ * @return false, leaving `matrix` alone, if the text is not twelve numbers.
+ */
+bool ParseBehaviorMatrix(const std::string &text, BehaviorMatrix *matrix);
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_BEHAVIOR_MATRIX_H_
@@ -19,36 +19,31 @@
  ******************************************************************************/
 NAMESPACE_BEGIN(csci3081);
 
-Controller::Controller() : last_dt(0) {
-  // Initialize default properties for various arena entities
-  arena_params aparams;
-  aparams.n_lights = N_LIGHTS;
-  aparams.n_foods = N_FOOD;
-  aparams.n_fear_robots = ROBOT_FEAR;
-  aparams.n_aggressive_robots = ROBOT_AGGRESSIVE;
-  aparams.n_explore_robots = ROBOT_EXPLORE;
-  aparams.n_love_robots = ROBOT_LOVE;
-  aparams.x_dim = ARENA_X_DIM;
-  aparams.y_dim = ARENA_Y_DIM;
+// Default properties for the various arena entities come from params.h
+Controller::Controller() : Controller(arena_params()) {}
 
-  arena_ = new Arena(&aparams);
+Controller::Controller(const struct arena_params &params) {
+  arena_ = new Arena(&params);
 
   // Start up the graphics (which creates the arena).
   // Run() will enter the nanogui::mainloop().
-  viewer_ = new GraphicsArenaViewer(&aparams, arena_, this);
+  viewer_ = new GraphicsArenaViewer(&params, arena_, this);
 }
 
 void Controller::Run() { viewer_->Run(); }
 
 void Controller::AdvanceTime(double dt) {
-  if ((last_dt + dt) <= .05) {
-    last_dt += dt;
+  if (arena_->get_game_status() != PLAYING || !(dt > 0))
     return;
-  }
-  last_dt = 0;
 
-  if (arena_->get_game_status() == PLAYING)
-    arena_->AdvanceTime(dt);
+  // the arena converts time into fixed ticks and carries the remainder;
+  // at max speed ask for as many ticks as one call will run
+  double sim_dt = speed_ > 0 ? dt * speed_ : MAX_SUBSTEPS * TICK_TIME;
+  unsigned long ticks = arena_->AdvanceTime(sim_dt, FRAME_BUDGET);
+
+  // smooth the achieved multiplier so the label does not flicker
+  double achieved = ticks * TICK_TIME / dt;
+  achieved_speed_ = 0.9 * achieved_speed_ + 0.1 * achieved;
 }
 
 void Controller::AcceptCommunication(Communication com) {
@@ -14,6 +14,7 @@
 #include <string>
 
 #include "src/arena.h"
+#include "src/arena_params.h"
 #include "src/common.h"
 #include "src/communication.h"
 #include "src/graphics_arena_viewer.h"
@@ -48,6 +49,13 @@ class Controller {
    */
   Controller();
 
+  /**
+   * @brief Constructor creating the Arena and Viewer for a scenario.
+   *
+   * @param params The scenario, e.g. loaded with LoadArenaParams().
+   */
+  explicit Controller(const struct arena_params &params);
+
   /**
    * @brief Run launches the graphics and starts the game.
    */
@@ -56,9 +64,30 @@ class Controller {
   /**
    * @brief AdvanceTime is communication from the Viewer to advance the
    * simulation.
+   *
+   * @param dt The real time since the last frame, in seconds. It is scaled by
+   * the speed multiplier and stepped within FRAME_BUDGET, so a slow arena
+   * runs fewer ticks per frame instead of stalling the UI.
    */
   void AdvanceTime(double dt);
 
+  /**
+   * @brief Set the requested speed multiplier. 0 means as fast as the frame
+   * budget allows.
+   */
+  void set_speed(double speed) { speed_ = speed; }
+
+  /**
+   * @brief Get the requested speed multiplier.
+   */
+  double get_speed() const { return speed_; }
+
+  /**
+   * @brief Get the speed multiplier actually achieved, smoothed over recent
+   * frames.
+   */
+  double get_achieved_speed() const { return achieved_speed_; }
+
   /**
    * @brief AcceptCommunication from either the viewer or the Arena
    */
@@ -109,8 +138,9 @@ class Controller {
     arena_->ChangeNumRobot(num, behv); }
 
  private:
-  double last_dt{0};
   Arena* arena_{nullptr};
+  double speed_{1};
+  double achieved_speed_{1};
   GraphicsArenaViewer* viewer_{nullptr};
 };
 
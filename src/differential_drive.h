@@ -0,0 +1,115 @@
+/**
+ * @file differential_drive.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_DIFFERENTIAL_DRIVE_H_
+#define SRC_DIFFERENTIAL_DRIVE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cmath>
+
+#include "src/common.h"
+#include "src/pose.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+// pi/2 in three parts; the first has a short mantissa, so q * kPio2Hi is
+// exact for any heading the simulation reaches
+constexpr double kTwoOverPi = 6.36619772367581382433e-01;
+constexpr double kPio2Hi = 1.57079632673412561417e+00;
+constexpr double kPio2Mid = 6.07710050630396597660e-11;
+constexpr double kPio2Lo = 2.02226624879595063154e-21;
+// 1.5 * 2^52: adding it to a double below 2^51 rounds away the fraction
+constexpr double kRoundMagic = 6755399441055744.0;
+
+// minimax coefficients for sin and cos on [-pi/4, pi/4] (from fdlibm)
+constexpr double kS1 = -1.66666666666666324348e-01;
+constexpr double kS2 = 8.33333333332248946124e-03;
+constexpr double kS3 = -1.98412698298579493134e-04;
+constexpr double kS4 = 2.75573137070700676789e-06;
+constexpr double kS5 = -2.50507602534068634195e-08;
+constexpr double kS6 = 1.58969099521155010221e-10;
+constexpr double kC1 = 4.16666666666666019037e-02;
+constexpr double kC2 = -1.38888888888741095749e-03;
+constexpr double kC3 = 2.48015872894767294178e-05;
+constexpr double kC4 = -2.75573143513906633035e-07;
+constexpr double kC5 = 2.08757232129817482790e-09;
+constexpr double kC6 = -1.13596475577881948265e-11;
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief sin and cos of `a` from one range reduction and two polynomials.
+ *
+ * There are no branches or library calls, so a loop calling it can be
+ * vectorised.
+ */
+inline void SinCos(double a, double *sin_a, double *cos_a) {
+  // q = a * 2/pi rounded to the nearest integer. Adding and subtracting
+  // 1.5 * 2^52 rounds without a call to floor or rint.
+  double q = (a * kTwoOverPi + kRoundMagic) - kRoundMagic;
+  double r = ((a - q * kPio2Hi) - q * kPio2Mid) - q * kPio2Lo;
+  double r2 = r * r;
+  double s = r + r * r2 * (kS1 + r2 * (kS2 + r2 * (kS3 + r2 * (kS4 +
+             r2 * (kS5 + r2 * kS6)))));
+  double c = 1.0 - 0.5 * r2 + r2 * r2 * (kC1 + r2 * (kC2 + r2 * (kC3 +
+             r2 * (kC4 + r2 * (kC5 + r2 * kC6)))));
+  // a = q * pi/2 + r, and m = q mod 4 (as -2 to 2) picks and negates the
+  // polynomials. Masks are combined with & and | rather than && and ||,
+  // which would be branches.
+  double m = q - 4.0 * ((q * 0.25 + kRoundMagic) - kRoundMagic);
+  double abs_m = std::fabs(m);
+  bool swap = (abs_m > 0.5) & (abs_m < 1.5);
+  double sin_sign = ((m > 1.5) | (m < -0.5)) ? -1.0 : 1.0;
+  double cos_sign = ((abs_m > 1.5) | (m > 0.5)) ? -1.0 : 1.0;
+  *sin_a = (swap ? c : s) * sin_sign;
+  *cos_a = (swap ? s : c) * cos_sign;
+}
+
+/**
+ * @brief Move one differential drive entity on by `dt` ticks.
+ *
+ * This is the simulation's differential drive model, rotation about the ICC
+ * with an axle of 0.5, written as a chord: with h = (vl - vr) * dt, the
+ * entity moves 0.5 * (vl + vr) * dt * sin(h)/h along the heading theta + h,
+ * and turns by 2h. The direction theta + h is the cached heading (dx, dy)
+ * rotated by h, so the only sin and cos are those of h and of the new
+ * heading, which becomes the next cached one. The straight case (h == 0) is
+ * a select of sin(h)/h = 1 rather than a separate branch. Like the original
+ * model, the turn (in radians) is added to `theta` in degrees.
+ *
+ * DifferentialDriveModel::Advance() and DifferentialIntegrator both run
+ * this function, so the scalar and batched paths give the same bits.
+ */
+inline void DifferentialDriveStep(double left, double right, double dt,
+                                  double *x, double *y, double *theta,
+                                  double *dx, double *dy) {
+  double half_turn = (left - right) * dt;
+  double sin_turn, cos_turn;
+  SinCos(half_turn, &sin_turn, &cos_turn);
+  // sin(h)/h, masked to 1 when driving straight: sin(0) is exactly 0, so
+  // adding the mask to both sides gives 1/1 there and leaves h != 0 alone
+  double straight = std::fabs(half_turn) > 0 ? 0.0 : 1.0;
+  double sinc = (sin_turn + straight) / (half_turn + straight);
+  double chord = 0.5 * (left + right) * dt * sinc;
+  // direction of travel: the cached heading rotated by h
+  *x += chord * (*dx * cos_turn - *dy * sin_turn);
+  *y += chord * (*dy * cos_turn + *dx * sin_turn);
+  *theta += 2 * half_turn;
+  SinCos(deg2rad(*theta), dy, dx);
+}
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_DIFFERENTIAL_DRIVE_H_
@@ -0,0 +1,48 @@
+/**
+ * @file differential_integrator.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/differential_drive.h"
+#include "src/differential_integrator.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void DifferentialIntegrator::Resize(size_t n) {
+  x_.resize(n);
+  y_.resize(n);
+  theta_.resize(n);
+  dx_.resize(n);
+  dy_.resize(n);
+  left_.resize(n);
+  right_.resize(n);
+}
+
+void DifferentialIntegrator::Integrate(size_t begin, size_t end, double dt) {
+  double *x = x_.data();
+  double *y = y_.data();
+  double *theta = theta_.data();
+  double *dx = dx_.data();
+  double *dy = dy_.data();
+  const double *left = left_.data();
+  const double *right = right_.data();
+
+  // Every statement of the step is a plain arithmetic or select on slot i,
+  // so the compiler can vectorise the loop when optimising.
+  for (size_t i = begin; i < end; ++i) {
+    DifferentialDriveStep(left[i], right[i], dt, &x[i], &y[i], &theta[i],
+                          &dx[i], &dy[i]);
+  }
+}
+
+NAMESPACE_END(csci3081);
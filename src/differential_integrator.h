@@ -0,0 +1,98 @@
+/**
+ * @file differential_integrator.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_DIFFERENTIAL_INTEGRATOR_H_
+#define SRC_DIFFERENTIAL_INTEGRATOR_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "src/common.h"
+#include "src/pose.h"
+#include "src/wheel_velocity.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Advances many differential drive entities at once.
+ *
+ * Poses and wheel velocities are held in separate contiguous arrays, one
+ * slot per entity. Integrate() runs DifferentialDriveStep() (see
+ * differential_drive.h), the kernel DifferentialDriveModel::Advance() runs
+ * too, over a range of slots in one branch-free loop, so a batch gives the
+ * same bits as advancing each entity through its model.
+ *
+ * Ranges of slots can be loaded, integrated and stored from different
+ * threads as long as the ranges do not overlap.
+ */
+class DifferentialIntegrator {
+ public:
+  DifferentialIntegrator()
+    : x_(), y_(), theta_(), dx_(), dy_(), left_(), right_() {}
+
+  /**
+   * @brief Set the number of slots.
+   */
+  void Resize(size_t n);
+
+  /**
+   * @brief Number of slots.
+   */
+  size_t size() const { return x_.size(); }
+
+  /**
+   * @brief Load one entity's pose, its Heading and wheel velocity into a
+   * slot.
+   */
+  void Load(size_t i, const Pose &pose, const Heading &heading,
+            const WheelVelocity &vel) {
+    x_[i] = pose.x;
+    y_[i] = pose.y;
+    theta_[i] = pose.theta;
+    dx_[i] = heading.dx;
+    dy_[i] = heading.dy;
+    left_[i] = vel.left;
+    right_[i] = vel.right;
+  }
+
+  /**
+   * @brief The pose held in a slot.
+   */
+  Pose get_pose(size_t i) const { return Pose(x_[i], y_[i], theta_[i]); }
+
+  /**
+   * @brief The Heading matching get_pose(i).theta.
+   */
+  Heading get_heading(size_t i) const {
+    return Heading(deg2rad(theta_[i]), dx_[i], dy_[i]);
+  }
+
+  /**
+   * @brief Advance the poses in slots [begin, end) by `dt`.
+   */
+  void Integrate(size_t begin, size_t end, double dt);
+
+ private:
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> theta_;
+  std::vector<double> dx_;
+  std::vector<double> dy_;
+  std::vector<double> left_;
+  std::vector<double> right_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_DIFFERENTIAL_INTEGRATOR_H_
@@ -0,0 +1,130 @@
+/**
+ * @file ensemble_runner.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "src/ensemble_runner.h"
+#include "src/arena.h"
+#include "src/task_graph.h"
+#include "src/thread_pool.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+EnsembleRunner::EnsembleRunner(const struct arena_params &params,
+                               unsigned int replicas, unsigned long max_ticks,
+                               unsigned int base_seed,
+                               unsigned int n_threads) :
+  params_(params),
+  replicas_(replicas),
+  max_ticks_(max_ticks),
+  base_seed_(base_seed),
+  n_threads_(n_threads),
+  results_() {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+EnsembleSummary EnsembleRunner::Run() {
+  results_.assign(replicas_, ReplicaResult());
+
+  auto start = std::chrono::steady_clock::now();
+  ThreadPool pool(n_threads_);
+  TaskGraph graph;
+  // one task per replica, so threads steal whole replicas from each other
+  graph.AddRangeTasks(replicas_, 1, [this](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      struct arena_params replica = params_;
+      replica.seed = base_seed_ + static_cast<unsigned int>(i);
+      replica.n_threads = 1;
+      results_[i] = RunReplica(replica, max_ticks_);
+    }
+  });
+  pool.Run(&graph);
+  auto stop = std::chrono::steady_clock::now();
+
+  EnsembleSummary summary = Summarize(results_);
+  summary.seconds = std::chrono::duration<double>(stop - start).count();
+  return summary;
+}
+
+ReplicaResult EnsembleRunner::RunReplica(const struct arena_params &params,
+                                         unsigned long max_ticks) {
+  ReplicaResult result;
+  result.seed = params.seed;
+
+  Arena arena(&params);
+  arena.set_game_status(PLAYING);
+  result.ticks = arena.StepTicks(max_ticks);
+  result.status = arena.get_game_status();
+  if (result.status == LOST) {
+    result.first_death_tick = arena.get_tick();
+  }
+  return result;
+}
+
+EnsembleSummary EnsembleRunner::Summarize(
+    const std::vector<ReplicaResult> &results) {
+  EnsembleSummary summary;
+  summary.replicas = static_cast<unsigned int>(results.size());
+
+  std::vector<unsigned long> deaths;
+  for (const ReplicaResult &res : results) {
+    if (res.status == WON) {
+      ++summary.won;
+    } else if (res.status == LOST) {
+      ++summary.lost;
+      deaths.push_back(res.first_death_tick);
+    } else {
+      ++summary.survived;
+    }
+  }
+  if (deaths.empty()) return summary;
+
+  std::sort(deaths.begin(), deaths.end());
+  double sum = 0;
+  for (unsigned long tick : deaths) sum += tick;
+  summary.mean_first_death = sum / deaths.size();
+  double sq = 0;
+  for (unsigned long tick : deaths) {
+    double diff = tick - summary.mean_first_death;
+    sq += diff * diff;
+  }
+  summary.stddev_first_death = std::sqrt(sq / deaths.size());
+  summary.min_first_death = deaths.front();
+  summary.median_first_death = deaths[deaths.size() / 2];
+  summary.max_first_death = deaths.back();
+  return summary;
+}
+
+void EnsembleRunner::Report(const EnsembleSummary &summary,
+                            std::ostream &out) {
+  out << "replicas:            " << summary.replicas << "\n"
+      << "wall time (s):       " << summary.seconds << "\n"
+      << "won:                 " << summary.won << "\n"
+      << "lost:                " << summary.lost << "\n"
+      << "survived:            " << summary.survived << "\n"
+      << "loss rate:           " << summary.loss_rate() << "\n";
+  if (summary.lost > 0) {
+    out << "first death (ticks): mean " << summary.mean_first_death
+        << ", sd " << summary.stddev_first_death
+        << ", min " << summary.min_first_death
+        << ", median " << summary.median_first_death
+        << ", max " << summary.max_first_death << "\n";
+  }
+}
+
+NAMESPACE_END(csci3081);
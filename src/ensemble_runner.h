@@ -0,0 +1,136 @@
+/**
+ * @file ensemble_runner.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_ENSEMBLE_RUNNER_H_
+#define SRC_ENSEMBLE_RUNNER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <ostream>
+#include <vector>
+
+#include "src/arena_params.h"
+#include "src/common.h"
+#include "src/params.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief Outcome of one replica of an ensemble.
+ */
+struct ReplicaResult {
+  // seed the replica's arena was built with
+  unsigned int seed{0};
+  // game status when the replica stopped (WON, LOST or PLAYING)
+  int status{PLAYING};
+  // number of ticks run
+  unsigned long ticks{0};
+  // tick at which the first robot died, or 0 if none did
+  unsigned long first_death_tick{0};
+};
+
+/**
+ * @brief Summary statistics over every replica of an ensemble.
+ */
+struct EnsembleSummary {
+  unsigned int replicas{0};
+  unsigned int won{0};
+  unsigned int lost{0};
+  // replicas still playing when they ran out of ticks
+  unsigned int survived{0};
+
+  // time to first death, over the replicas that lost
+  double mean_first_death{0};
+  double stddev_first_death{0};
+  unsigned long min_first_death{0};
+  unsigned long median_first_death{0};
+  unsigned long max_first_death{0};
+
+  // wall clock time for the whole ensemble, in seconds
+  double seconds{0};
+
+  /**
+   * @brief Fraction of replicas in which a robot died.
+   */
+  double loss_rate() const {
+    return replicas > 0 ? static_cast<double>(lost) / replicas : 0;
+  }
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Runs many independent, differently seeded arenas across all cores.
+ *
+ * Every replica is built from the same arena_params with seed
+ * `base_seed + index`, run for up to `max_ticks` or until the game is lost,
+ * and destroyed before the thread moves on. Only the small ReplicaResult of
+ * each replica is kept, so memory does not grow with the number of replicas.
+ * Each replica runs single threaded; the replicas themselves are spread over
+ * a work-stealing ThreadPool.
+ */
+class EnsembleRunner {
+ public:
+  /**
+   * @brief Constructor.
+   *
+   * @param params The arena to replicate. Its seed and thread count are
+   * overridden per replica.
+   * @param replicas The number of replicas.
+   * @param max_ticks Upper bound on the ticks each replica runs.
+   * @param base_seed Seed of the first replica; must not be 0.
+   * @param n_threads Threads running replicas (0 = all hardware threads).
+   */
+  EnsembleRunner(const struct arena_params &params, unsigned int replicas,
+                 unsigned long max_ticks, unsigned int base_seed = 1,
+                 unsigned int n_threads = 0);
+
+  /**
+   * @brief Run every replica and summarise the outcomes.
+   */
+  EnsembleSummary Run();
+
+  /**
+   * @brief The per-replica results of the last Run(), in seed order.
+   */
+  const std::vector<ReplicaResult> &get_results() const { return results_; }
+
+  /**
+   * @brief Summarise a set of replica results.
+   */
+  static EnsembleSummary Summarize(const std::vector<ReplicaResult> &results);
+
+  /**
+   * @brief Print a summary.
+   */
+  static void Report(const EnsembleSummary &summary, std::ostream &out);
+
+  /**
+   * @brief Run a single replica.
+   */
+  static ReplicaResult RunReplica(const struct arena_params &params,
+                                  unsigned long max_ticks);
+
+ private:
+  struct arena_params params_;
+  unsigned int replicas_;
+  unsigned long max_ticks_;
+  unsigned int base_seed_;
+  unsigned int n_threads_;
+  std::vector<ReplicaResult> results_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_ENSEMBLE_RUNNER_H_
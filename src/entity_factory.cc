@@ -27,8 +27,18 @@ NAMESPACE_BEGIN(csci3081);
  * Class Definitions
  ******************************************************************************/
 
-EntityFactory::EntityFactory() {
-  srand(time(nullptr));
+EntityFactory::EntityFactory(unsigned int seed) :
+  params_(),
+  rng_(),
+  profiles_(&RobotProfileTable::Default()) {
+  // every draw comes from rng_, so the global rand() state is left alone
+  if (seed == 0) seed = static_cast<unsigned int>(time(nullptr));
+  rng_.seed(seed);
+}
+
+EntityFactory::EntityFactory(const struct arena_params &params) :
+  EntityFactory(params.seed) {
+  params_ = params;
 }
 
 ArenaEntity* EntityFactory::CreateEntity(EntityType etype) {
@@ -50,23 +60,15 @@ ArenaEntity* EntityFactory::CreateEntity(EntityType etype) {
 }
 
 Robot* EntityFactory::CreateRobot() {
-  auto* robot = new Robot;
-  robot->set_type(kRobot);
-  robot->set_color(ROBOT_COLOR);
-  robot->set_pose(SetPoseRandomly());
-  robot->set_radius(random() % (ROBOT_MAX_RADIUS - ROBOT_MIN_RADIUS
-    + 1) + ROBOT_MIN_RADIUS);
+  auto* robot = new Robot(kNothing, SetPoseRandomly(), RandomRobotRadius(),
+                          profiles_);
   ++entity_count_;
   return robot;
 }
 
 Light* EntityFactory::CreateLight() {
-  auto* light = new Light;
-  light->set_type(kLight);
-  light->set_color(OBSTACLE_COLOR);
-  light->set_pose(SetPoseRandomly());
-  light->set_radius(random() % (OBSTACLE_MAX_RADIUS - OBSTACLE_MIN_RADIUS
-    + 1) + OBSTACLE_MIN_RADIUS);
+  auto* light = new Light(SetPoseRandomly(), RandomLightRadius());
+  ConfigureLight(light);
   ++entity_count_;
   ++light_count_;
 
@@ -75,21 +77,124 @@ Light* EntityFactory::CreateLight() {
 }
 
 Food* EntityFactory::CreateFood() {
-  auto* food = new Food;
-  food->set_type(kFood);
-  food->set_color(FOOD_COLOR);
-  food->set_pose(SetPoseRandomly());
-  food->set_radius(FOOD_RADIUS);
+  auto* food = new Food(SetPoseRandomly());
+  ConfigureFood(food);
   ++entity_count_;
   ++food_count_;
   food->set_id(food_count_);
   return food;
 }
 
+void EntityFactory::CreateRobots(int quantity, RobotBehaviorEnum behv,
+                                 std::vector<Robot *> *out) {
+  if (quantity <= 0) return;
+  std::vector<Pose> poses;
+  PlaceBatch(quantity, &poses);
+  out->reserve(out->size() + quantity);
+  for (const Pose &pose : poses) {
+    out->push_back(new Robot(behv, pose, RandomRobotRadius(), profiles_));
+  }
+  entity_count_ += quantity;
+  AddRobotCount(behv, quantity);
+}
+
+void EntityFactory::CreateLights(int quantity, std::vector<Light *> *out) {
+  if (quantity <= 0) return;
+  std::vector<Pose> poses;
+  PlaceBatch(quantity, &poses);
+  out->reserve(out->size() + quantity);
+  for (const Pose &pose : poses) {
+    auto* light = new Light(pose, RandomLightRadius());
+    ConfigureLight(light);
+    light->set_id(++light_count_);
+    out->push_back(light);
+  }
+  entity_count_ += quantity;
+}
+
+void EntityFactory::CreateFoods(int quantity, std::vector<Food *> *out) {
+  if (quantity <= 0) return;
+  std::vector<Pose> poses;
+  PlaceBatch(quantity, &poses);
+  out->reserve(out->size() + quantity);
+  for (const Pose &pose : poses) {
+    auto* food = new Food(pose);
+    ConfigureFood(food);
+    food->set_id(++food_count_);
+    out->push_back(food);
+  }
+  entity_count_ += quantity;
+}
+
+void EntityFactory::Place(Robot *robot) {
+  const RobotProfile &prof = robot->get_profile();
+  robot->set_pose(SetPoseRandomly());
+  robot->set_radius(RandomInRange(prof.min_radius, prof.max_radius));
+}
+
+void EntityFactory::Place(Light *light) {
+  light->set_pose(SetPoseRandomly());
+  light->set_radius(RandomLightRadius());
+}
+
+void EntityFactory::Place(Food *food) {
+  food->set_pose(SetPoseRandomly());
+}
+
+void EntityFactory::PlaceBatch(int quantity, std::vector<Pose> *poses) {
+  poses->reserve(poses->size() + quantity);
+  for (int i = 0; i < quantity; i++) {
+    poses->push_back(SetPoseRandomly());
+  }
+}
+
+void EntityFactory::AddRobotCount(RobotBehaviorEnum behv, int quantity) {
+  switch (behv) {
+    case kFear: robot_fear_count_ += quantity;
+      break;
+    case kAggressive: robot_aggressive_count_ += quantity;
+      break;
+    case kExplore: robot_explore_count_ += quantity;
+      break;
+    case kLove: robot_love_count_ += quantity;
+      break;
+    case kNeural: robot_neural_count_ += quantity;
+      break;
+    default: {}
+  }
+}
+
+double EntityFactory::RandomRobotRadius() {
+  return RandomInRange(params_.robot_min_radius, params_.robot_max_radius);
+}
+
+double EntityFactory::RandomLightRadius() {
+  return RandomInRange(params_.light_min_radius, params_.light_max_radius);
+}
+
+double EntityFactory::RandomInRange(double min, double max) {
+  unsigned int range = max > min ? static_cast<unsigned int>(max - min) : 0;
+  return rng_() % (range + 1) + min;
+}
+
+void EntityFactory::ConfigureLight(Light *light) const {
+  light->set_color(params_.light_color);
+  light->set_speed(params_.light_speed);
+  light->set_arc_length(params_.arc_ticks);
+}
+
+void EntityFactory::ConfigureFood(Food *food) const {
+  food->set_color(params_.food_color);
+  food->set_radius(params_.food_radius);
+}
+
 Pose EntityFactory::SetPoseRandomly() {
-  // Dividing arena into 19x14 grid. Each grid square is 50x50
-  return {static_cast<double>((30 + (random() % 19) * 50)),
-          static_cast<double>((30 + (random() % 14) * 50))};
+  // Dividing arena into a grid of 50x50 squares, 19x14 in the default
+  // arena. The last 250 units are left clear of starting positions.
+  unsigned int cols = params_.x_dim > 300 ? (params_.x_dim - 250) / 50 : 1;
+  unsigned int rows = params_.y_dim > 300 ? (params_.y_dim - 250) / 50 : 1;
+  return {static_cast<double>((30 + (rng_() % cols) * 50)),
+          static_cast<double>((30 + (rng_() % rows) * 50))};
 }
 
 NAMESPACE_END(csci3081);
@@ -10,8 +10,11 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <random>
 #include <string>
+#include <vector>
 
+#include "src/arena_params.h"
 #include "src/food.h"
 #include "src/common.h"
 #include "src/entity_type.h"
@@ -42,14 +45,26 @@ class EntityFactory {
   /**
    * @brief EntityFactory constructor.
    *
+   * @param seed Seed for the factory's random placement. Two factories with
+   * the same non-zero seed place entities identically. 0 seeds from the
+   * current time.
    */
-  EntityFactory();
+  explicit EntityFactory(unsigned int seed = 0);
+
+  /**
+   * @brief EntityFactory constructor taking its radii, speeds and colours,
+   * and its seed, from an arena_params.
+   */
+  explicit EntityFactory(const struct arena_params &params);
 
   /**
    * @brief Default destructor.
    */
   virtual ~EntityFactory() = default;
 
+  EntityFactory(const EntityFactory &other) = delete;
+  EntityFactory &operator=(const EntityFactory &other) = delete;
+
   /**
   * @brief CreateEntity is primary purpose of this class.
   *
@@ -64,9 +79,45 @@ class EntityFactory {
   ArenaEntity* CreateEntity(EntityType etype);
 
   /**
-  * @brief Public - An attempt to not overlap any of the newly constructed entities.
+  * @brief Create a batch of robots with the same behavior.
+  *
+  * Poses and radii for the whole batch are drawn first, then every robot is
+  * constructed with its final pose and behavior in one pass. The new robots
+  * are appended to `out`, whose capacity is reserved up front.
+  *
+  * @param[in] quantity The number of robots to create.
+  * @param[in] behv The behavior of every robot in the batch.
+  * @param[out] out The vector the new robots are appended to.
+  */
+  void CreateRobots(int quantity, RobotBehaviorEnum behv,
+                    std::vector<Robot *> *out);
+
+  /**
+  * @brief Create a batch of lights. See CreateRobots().
+  */
+  void CreateLights(int quantity, std::vector<Light *> *out);
+
+  /**
+  * @brief Create a batch of food. See CreateRobots().
+  */
+  void CreateFoods(int quantity, std::vector<Food *> *out);
+
+  /**
+  * @brief Set the profile table new robots are configured from. It must
+  * outlive every robot the factory creates.
   */
-  Pose SetPoseRandomlyAux();
+  void set_profile_table(const RobotProfileTable *profiles) {
+    profiles_ = profiles;
+  }
+
+  /**
+  * @brief Place an entity again after a Reset, as a new one would be: a
+  * random position in the configured arena and, for robots and lights, a
+  * random radius in the configured range. Food keeps its radius.
+  */
+  void Place(Robot *robot);
+  void Place(Light *light);
+  void Place(Food *food);
 
   /**
   * @brief return fear robot count
@@ -116,6 +167,22 @@ class EntityFactory {
   void love_robot_increment() { robot_love_count_++; }
 
 
+  /**
+  * @brief return neural robot count
+  */
+  int get_neural_robot_count() { return robot_neural_count_; }
+
+  /**
+  * @brief decrement neural robot count
+  */
+  void neural_robot_decrement() { robot_neural_count_--; }
+
+  /**
+  * @brief increment neural robot count
+  */
+  void neural_robot_increment() { robot_neural_count_++; }
+
+
   /**
   * @brief return aggressive robot count
   */
@@ -174,6 +241,52 @@ class EntityFactory {
   */
   Pose SetPoseRandomly();
 
+  /**
+  * @brief Draw `quantity` random poses in one pass.
+  */
+  void PlaceBatch(int quantity, std::vector<Pose> *poses);
+
+  /**
+  * @brief Add `quantity` to the count of robots with behavior `behv`.
+  */
+  void AddRobotCount(RobotBehaviorEnum behv, int quantity);
+
+  /**
+  * @brief A random robot radius within [robot_min_radius, robot_max_radius].
+  */
+  double RandomRobotRadius();
+
+  /**
+  * @brief A random light radius within [light_min_radius, light_max_radius].
+  */
+  double RandomLightRadius();
+
+  /**
+  * @brief A random whole number within [min, max].
+  */
+  double RandomInRange(double min, double max);
+
+  /**
+  * @brief Apply the configured speed, arc length and colour
+  * to a new light.
+  */
+  void ConfigureLight(Light *light) const;
+
+  /**
+  * @brief Apply the configured radius and colour to new food.
+  */
+  void ConfigureFood(Food *food) const;
+
+  // Radii, speeds, colours and arena size new entities are built with
+  struct arena_params params_;
+
+  // Each factory has its own generator, so arenas built in parallel do not
+  // share (or race on) the global random() state.
+  std::minstd_rand rng_;
+
+  // table new robots read their configuration from
+  const RobotProfileTable *profiles_;
+
   /* Factory tracks the number of created entities.*/
   int entity_count_{0};
   int light_count_{0};
@@ -181,6 +294,7 @@ class EntityFactory {
   int robot_fear_count_{0};
   int robot_explore_count_{0};
   int robot_love_count_{0};
+  int robot_neural_count_{0};
   int robot_aggressive_count_{0};
 };
 
@@ -0,0 +1,168 @@
+/**
+ * @file entity_view.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_ENTITY_VIEW_H_
+#define SRC_ENTITY_VIEW_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+
+#include "src/arena_entity.h"
+#include "src/common.h"
+#include "src/entity_type.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief A read-only, non-owning range over a contiguous block of entity
+ * pointers held by the Arena.
+ *
+ * Creating a view never allocates or copies the underlying container. A view
+ * is only valid until the Arena next adds or removes entities; the generation
+ * it was taken at can be compared against Arena::get_generation() to find out
+ * whether that has happened.
+ *
+ * @tparam T The entity type stored in the viewed container (e.g. Robot).
+ */
+template <typename T>
+class EntityView {
+ public:
+  typedef T *const *const_iterator;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param first Pointer to the first element of the viewed block.
+   * @param count Number of elements in the block.
+   * @param generation The Arena generation the view was taken at.
+   */
+  EntityView(T *const *first, size_t count, unsigned int generation)
+    : first_(first), count_(count), generation_(generation) {}
+
+  /**
+   * @brief Iterator to the first entity.
+   */
+  const_iterator begin() const { return first_; }
+
+  /**
+   * @brief Iterator one past the last entity.
+   */
+  const_iterator end() const { return first_ + count_; }
+
+  /**
+   * @brief Number of entities in the view.
+   */
+  size_t size() const { return count_; }
+
+  /**
+   * @brief Whether the view holds no entities.
+   */
+  bool empty() const { return count_ == 0; }
+
+  /**
+   * @brief Access the entity at index i. No bounds checking is performed.
+   */
+  T *operator[](size_t i) const { return first_[i]; }
+
+  /**
+   * @brief The Arena generation the view was taken at.
+   */
+  unsigned int get_generation() const { return generation_; }
+
+ private:
+  T *const *first_;
+  size_t count_;
+  unsigned int generation_;
+};
+
+/**
+ * @brief A read-only view over all Arena entities that only visits the
+ * entities of a single EntityType.
+ *
+ * Filtering is done lazily while iterating, so no temporary container is
+ * built.
+ */
+class EntityTypeView {
+ public:
+  /**
+   * @brief Forward iterator skipping entities of any other type.
+   */
+  class const_iterator {
+   public:
+    const_iterator(ArenaEntity *const *pos, ArenaEntity *const *last,
+                   EntityType type)
+      : pos_(pos), last_(last), type_(type) { SkipOthers(); }
+
+    ArenaEntity *operator*() const { return *pos_; }
+
+    const_iterator &operator++() {
+      ++pos_;
+      SkipOthers();
+      return *this;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return pos_ == other.pos_;
+    }
+
+    bool operator!=(const const_iterator &other) const {
+      return pos_ != other.pos_;
+    }
+
+   private:
+    void SkipOthers() {
+      while (pos_ != last_ && (*pos_)->get_type() != type_) ++pos_;
+    }
+
+    ArenaEntity *const *pos_;
+    ArenaEntity *const *last_;
+    EntityType type_;
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param all View over every entity in the Arena.
+   * @param type The only EntityType the view will visit.
+   */
+  EntityTypeView(const EntityView<ArenaEntity> &all, EntityType type)
+    : all_(all), type_(type) {}
+
+  /**
+   * @brief Iterator to the first entity of the requested type.
+   */
+  const_iterator begin() const {
+    return const_iterator(all_.begin(), all_.end(), type_);
+  }
+
+  /**
+   * @brief Iterator one past the last entity.
+   */
+  const_iterator end() const {
+    return const_iterator(all_.end(), all_.end(), type_);
+  }
+
+  /**
+   * @brief The Arena generation the view was taken at.
+   */
+  unsigned int get_generation() const { return all_.get_generation(); }
+
+ private:
+  EntityView<ArenaEntity> all_;
+  EntityType type_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_ENTITY_VIEW_H_
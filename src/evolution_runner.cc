@@ -0,0 +1,207 @@
+/**
+ * @file evolution_runner.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <chrono>
+
+#include "src/evolution_runner.h"
+#include "src/task_graph.h"
+#include "src/thread_pool.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+// genomes drawn per tournament
+static const unsigned int kTournamentSize = 2;
+// standard deviation of a mutation, as a fraction of the gene's range
+static const double kMutationScale = 0.1;
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+EvolutionRunner::EvolutionRunner(const struct arena_params &base,
+                                 const std::vector<SweepDimension> &genes,
+                                 unsigned int population,
+                                 unsigned int replicas,
+                                 unsigned long max_ticks, unsigned int seed,
+                                 unsigned int n_threads) :
+  base_(base),
+  genes_(genes),
+  population_(std::max(population, 2u)),
+  replicas_(std::max(replicas, 1u)),
+  max_ticks_(max_ticks),
+  seed_(seed),
+  n_threads_(n_threads),
+  rng_(seed),
+  cache_() {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+EvolutionStats EvolutionRunner::Run(unsigned int generations,
+                                    std::ostream &out) {
+  WriteHeader(out);
+  out.flush();
+
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::vector<Genome> genomes(population_);
+  for (Genome &genome : genomes) {
+    for (const SweepDimension &gene : genes_) {
+      genome.push_back(gene.min + (gene.max - gene.min) * unit(rng_));
+    }
+  }
+
+  ThreadPool pool(n_threads_);
+  EvolutionStats stats;
+  for (unsigned int g = 0; g < generations; ++g) {
+    auto start = std::chrono::steady_clock::now();
+    stats = EvolutionStats();
+    stats.generation = g;
+    stats.population = genomes.size();
+    std::vector<double> fitness = Evaluate(genomes, &pool, &stats.evaluated);
+
+    size_t best = 0;
+    double sum = 0;
+    stats.worst = fitness[0];
+    for (size_t i = 0; i < fitness.size(); ++i) {
+      if (fitness[i] > fitness[best]) best = i;
+      stats.worst = std::min(stats.worst, fitness[i]);
+      sum += fitness[i];
+    }
+    stats.best = fitness[best];
+    stats.mean = sum / fitness.size();
+    stats.best_genome = genomes[best];
+    auto stop = std::chrono::steady_clock::now();
+    stats.seconds = std::chrono::duration<double>(stop - start).count();
+    WriteRow(out, stats);
+    out.flush();
+
+    if (g + 1 < generations) genomes = Breed(genomes, fitness);
+  }
+  return stats;
+}
+
+double EvolutionRunner::Fitness(const std::vector<ReplicaResult> &results,
+                                unsigned long max_ticks) {
+  if (results.empty()) return 0;
+  double sum = 0;
+  for (const ReplicaResult &res : results) {
+    sum += res.status == LOST ? res.first_death_tick : max_ticks;
+  }
+  return sum / results.size();
+}
+
+std::vector<double> EvolutionRunner::Evaluate(
+    const std::vector<Genome> &genomes, ThreadPool *pool,
+    size_t *evaluated) {
+  // each genome not seen before is run once, however often it appears
+  std::vector<const Genome *> pending;
+  std::map<Genome, size_t> slot;
+  for (const Genome &genome : genomes) {
+    if (cache_.count(genome) > 0 || slot.count(genome) > 0) continue;
+    slot[genome] = pending.size();
+    pending.push_back(&genome);
+  }
+  *evaluated = pending.size();
+
+  // one task per replica rather than per genome keeps every thread busy
+  // while the last genomes finish
+  std::vector<ReplicaResult> results(pending.size() * replicas_);
+  TaskGraph graph;
+  graph.AddRangeTasks(results.size(), 1,
+    [this, &pending, &results](size_t begin, size_t end) {
+      for (size_t t = begin; t < end; ++t) {
+        const Genome &genome = *pending[t / replicas_];
+        struct arena_params params = base_;
+        for (size_t d = 0; d < genes_.size(); ++d) {
+          SweepRunner::ApplyValue(genes_[d].name, genome[d], &params);
+        }
+        params.n_threads = 1;
+        params.seed = seed_ + static_cast<unsigned int>(t % replicas_);
+        results[t] = EnsembleRunner::RunReplica(params, max_ticks_);
+      }
+    });
+  pool->Run(&graph);
+
+  for (size_t p = 0; p < pending.size(); ++p) {
+    std::vector<ReplicaResult> mine(results.begin() + p * replicas_,
+                                    results.begin() + (p + 1) * replicas_);
+    cache_[*pending[p]] = Fitness(mine, max_ticks_);
+  }
+  std::vector<double> fitness;
+  fitness.reserve(genomes.size());
+  for (const Genome &genome : genomes) fitness.push_back(cache_[genome]);
+  return fitness;
+}
+
+std::vector<EvolutionRunner::Genome> EvolutionRunner::Breed(
+    const std::vector<Genome> &genomes, const std::vector<double> &fitness) {
+  std::vector<Genome> next;
+  next.reserve(genomes.size());
+  // the fittest genome survives unchanged
+  next.push_back(genomes[std::max_element(fitness.begin(), fitness.end()) -
+                         fitness.begin()]);
+
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  // on average one gene of each child mutates
+  double mutation_rate = 1.0 / std::max<size_t>(genes_.size(), 1);
+  while (next.size() < genomes.size()) {
+    const Genome &mother = Tournament(genomes, fitness);
+    const Genome &father = Tournament(genomes, fitness);
+    Genome child(genes_.size());
+    for (size_t d = 0; d < genes_.size(); ++d) {
+      const SweepDimension &gene = genes_[d];
+      child[d] = unit(rng_) < 0.5 ? mother[d] : father[d];
+      if (unit(rng_) < mutation_rate) {
+        child[d] += normal(rng_) * kMutationScale * (gene.max - gene.min);
+        child[d] = std::min(std::max(child[d], gene.min), gene.max);
+      }
+    }
+    next.push_back(child);
+  }
+  return next;
+}
+
+const EvolutionRunner::Genome &EvolutionRunner::Tournament(
+    const std::vector<Genome> &genomes, const std::vector<double> &fitness) {
+  std::uniform_int_distribution<size_t> pick(0, genomes.size() - 1);
+  size_t winner = pick(rng_);
+  for (unsigned int k = 1; k < kTournamentSize; ++k) {
+    size_t rival = pick(rng_);
+    if (fitness[rival] > fitness[winner]) winner = rival;
+  }
+  return genomes[winner];
+}
+
+void EvolutionRunner::WriteHeader(std::ostream &out) const {
+  out << "generation,population,evaluated,best,mean,worst,seconds";
+  for (const SweepDimension &gene : genes_) {
+    out << "," << gene.name;
+  }
+  out << "\n";
+}
+
+void EvolutionRunner::WriteRow(std::ostream &out,
+                               const EvolutionStats &stats) const {
+  out << stats.generation << "," << stats.population << ","
+      << stats.evaluated << "," << stats.best << "," << stats.mean << ","
+      << stats.worst << "," << stats.seconds;
+  for (double value : stats.best_genome) {
+    out << "," << value;
+  }
+  out << "\n";
+}
+
+NAMESPACE_END(csci3081);
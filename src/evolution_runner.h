@@ -0,0 +1,140 @@
+/**
+ * @file evolution_runner.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_EVOLUTION_RUNNER_H_
+#define SRC_EVOLUTION_RUNNER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <map>
+#include <ostream>
+#include <random>
+#include <vector>
+
+#include "src/arena_params.h"
+#include "src/common.h"
+#include "src/ensemble_runner.h"
+#include "src/sweep_runner.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+class ThreadPool;
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief Statistics of one generation of an EvolutionRunner.
+ */
+struct EvolutionStats {
+  unsigned int generation{0};
+  // genomes in the generation, and how many of them were run rather than
+  // found in the fitness cache
+  size_t population{0};
+  size_t evaluated{0};
+  // fitness over the generation
+  double best{0};
+  double mean{0};
+  double worst{0};
+  // the fittest genome so far, one value per gene
+  std::vector<double> best_genome{};
+  // wall clock time for the generation, in seconds
+  double seconds{0};
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Searches behavior parameters for robots that stay alive, with a
+ * simple genetic algorithm.
+ *
+ * A genome holds one value per gene, each gene a tunable with a range as in
+ * a sweep, e.g. a weight of a behavior matrix such as `fear_matrix.3` (see
+ * SetArenaParamValue()). Its fitness is the mean, over `replicas` arenas,
+ * of the tick the first robot died at, or `max_ticks` if none did. Every
+ * genome is run on the same seeds, so genomes are compared on the same
+ * arenas and a genome's fitness never changes.
+ *
+ * Each generation keeps its fittest genome and breeds the rest by
+ * tournament selection, uniform crossover and Gaussian mutation. Fitness is
+ * cached by genome, so the kept genome and any child identical to a genome
+ * already seen are not run again. The replicas of the genomes that do run
+ * are spread over a work-stealing ThreadPool, one task each, so a small
+ * population still fills every core. Genomes are bred on the calling
+ * thread from `seed` alone, so the search is the same whatever the thread
+ * count.
+ */
+class EvolutionRunner {
+ public:
+  /**
+   * @brief Constructor.
+   *
+   * @param base The arena every genome is run in.
+   * @param genes The tunables searched, with their ranges; `steps` is not
+   * used.
+   * @param population Genomes per generation.
+   * @param replicas Arenas run per genome.
+   * @param max_ticks Upper bound on the ticks each replica runs.
+   * @param seed Seed for breeding and the replicas; must not be 0.
+   * @param n_threads Threads running replicas (0 = all hardware threads).
+   */
+  EvolutionRunner(const struct arena_params &base,
+                  const std::vector<SweepDimension> &genes,
+                  unsigned int population, unsigned int replicas,
+                  unsigned long max_ticks, unsigned int seed,
+                  unsigned int n_threads);
+
+  /**
+   * @brief Run `generations` generations, writing a CSV row of statistics
+   * to `out` as each one finishes.
+   *
+   * @return The statistics of the last generation, which hold the fittest
+   * genome found.
+   */
+  EvolutionStats Run(unsigned int generations, std::ostream &out);
+
+  /**
+   * @brief The fitness of a genome from its replicas' results.
+   */
+  static double Fitness(const std::vector<ReplicaResult> &results,
+                        unsigned long max_ticks);
+
+  /**
+   * @brief Number of distinct genomes run so far.
+   */
+  size_t get_cache_size() const { return cache_.size(); }
+
+ private:
+  typedef std::vector<double> Genome;
+
+  std::vector<double> Evaluate(const std::vector<Genome> &genomes,
+                               ThreadPool *pool, size_t *evaluated);
+  std::vector<Genome> Breed(const std::vector<Genome> &genomes,
+                            const std::vector<double> &fitness);
+  const Genome &Tournament(const std::vector<Genome> &genomes,
+                           const std::vector<double> &fitness);
+  void WriteHeader(std::ostream &out) const;
+  void WriteRow(std::ostream &out, const EvolutionStats &stats) const;
+
+  struct arena_params base_;
+  std::vector<SweepDimension> genes_;
+  unsigned int population_;
+  unsigned int replicas_;
+  unsigned long max_ticks_;
+  unsigned int seed_;
+  unsigned int n_threads_;
+  std::minstd_rand rng_;
+  std::map<Genome, double> cache_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_EVOLUTION_RUNNER_H_
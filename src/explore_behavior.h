@@ -11,6 +11,7 @@
  * Includes
  ******************************************************************************/
 #include "src/common.h"
+#include "src/memory_accounting.h"
 #include "src/robot_behavior.h"
 
 /*******************************************************************************
@@ -24,32 +25,18 @@ NAMESPACE_BEGIN(csci3081);
 /**
  * @brief Class representing the explore behavior of a robot.
  *
- * This class inherits from RobotBehavior and uses an overrided method
- * to determine the velocity of the robot and pass it back to the robot
- * object to be used by the motion handler. 
+ * A RobotBehavior starting from the kExploreMatrix preset (see
+ * behavior_matrix.h).
  */
-class ExploreBehavior : public RobotBehavior {
+class ExploreBehavior : public RobotBehavior,
+                        private Accounted<ExploreBehavior, kAccountBehavior> {
  public:
   /**
    * @brief Constructor for initializing the behavior.
    */
   ExploreBehavior();
 
-  /**
-   * @brief Calculate the velocity the robot should be moving at, depending
-   * on several factors.
-   *
-   * @param[in] light_left The reading from the robots left light sensor.
-   * @param[in] light_right The reading from the robots right light sensor.
-   * @param[in] food_left The reading from the robots left food sensor.
-   * @param[in] food_right The reading from the robots right light sensor.
-   * @param[in] hungry The bool value that specifies whether the robot is hungry.
-   * @param[out] returns the wheel velocity that has been calculated
-   */
-  WheelVelocity Movement(double light_left, double light_right,
-                double food_left, double food_right, bool hungry) override;
-
-  /**
+ /**
   * @brief Command that returns the behavior type for the class.
   * @param[out] behv_ The enum type of the behavior
   */
@@ -0,0 +1,66 @@
+/**
+ * @file fixed_differential_integrator.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/fixed_differential_integrator.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void FixedDifferentialIntegrator::Resize(size_t n) {
+  x_.resize(n);
+  y_.resize(n);
+  theta_.resize(n);
+  left_.resize(n);
+  right_.resize(n);
+}
+
+void FixedDifferentialIntegrator::Integrate(size_t begin, size_t end,
+                                            double dt) {
+  int32_t *x = x_.data();
+  int32_t *y = y_.data();
+  FixedAngle *theta = theta_.data();
+  const int32_t *left = left_.data();
+  const int32_t *right = right_.data();
+  const int32_t *table = FixedSinTable();
+  int64_t step = Fixed::FromDouble(dt).raw();
+
+  // Only integer arithmetic, table reads and selects on slot i, as in
+  // DifferentialIntegrator::Integrate().
+  for (size_t i = begin; i < end; ++i) {
+    // h = (vl - vr) * dt, in radians
+    int64_t half_turn = (static_cast<int64_t>(left[i]) - right[i]) * step >>
+                        Fixed::kFracBits;
+    FixedAngle turn = RadiansToAngle(
+      Fixed::FromRaw(static_cast<int32_t>(half_turn)));
+    int64_t sin_turn = FixedSin(table, turn).raw();
+    // sin(h)/h, masked to 1 when driving straight as in the double version
+    int64_t straight = half_turn == 0 ? Fixed::kOne : 0;
+    int64_t sinc = (sin_turn + straight) * Fixed::kOne /
+                   (half_turn + straight);
+    int64_t speed = (static_cast<int64_t>(left[i]) + right[i]) * step >>
+                    (Fixed::kFracBits + 1);
+    int64_t chord = speed * sinc >> Fixed::kFracBits;
+    FixedAngle direction = theta[i] + turn;
+    x[i] += static_cast<int32_t>(
+      chord * FixedCos(table, direction).raw() >> Fixed::kFracBits);
+    y[i] += static_cast<int32_t>(
+      chord * FixedSin(table, direction).raw() >> Fixed::kFracBits);
+    // the scalar model adds the turn, in radians, to a heading in degrees:
+    // 2h degrees is 2h * 2^32 / 360 of a binary turn
+    theta[i] += static_cast<FixedAngle>(static_cast<uint64_t>(
+      half_turn * (1LL << 17) / 360));
+  }
+}
+
+NAMESPACE_END(csci3081);
@@ -0,0 +1,110 @@
+/**
+ * @file fixed_differential_integrator.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_FIXED_DIFFERENTIAL_INTEGRATOR_H_
+#define SRC_FIXED_DIFFERENTIAL_INTEGRATOR_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "src/common.h"
+#include "src/fixed_point.h"
+#include "src/pose.h"
+#include "src/wheel_velocity.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief DifferentialIntegrator in Q16.16 fixed point (see fixed_point.h).
+ *
+ * It has the same interface and runs the chord form of the differential
+ * drive model in DifferentialDriveStep(), but positions and wheel speeds are
+ * rounded to Q16.16 on Load() and everything after that is integer
+ * arithmetic, with sin and cos read from FixedSinTable(). The poses it produces are therefore
+ * the same bits whatever the compiler, its flags, the vector width or the
+ * thread count, and they are exact in double, so storing and reloading them
+ * loses nothing.
+ *
+ * The Heading passed to Load() is not used: the direction of travel comes
+ * from the fixed point heading, and get_heading() returns the table's sine
+ * and cosine of it.
+ *
+ * Ranges of slots can be loaded, integrated and stored from different
+ * threads as long as the ranges do not overlap.
+ */
+class FixedDifferentialIntegrator {
+ public:
+  FixedDifferentialIntegrator()
+    : x_(), y_(), theta_(), left_(), right_() {}
+
+  /**
+   * @brief Set the number of slots.
+   */
+  void Resize(size_t n);
+
+  /**
+   * @brief Number of slots.
+   */
+  size_t size() const { return x_.size(); }
+
+  /**
+   * @brief Load one entity's pose and wheel velocity into a slot, rounded
+   * to fixed point.
+   */
+  void Load(size_t i, const Pose &pose, const Heading &,
+            const WheelVelocity &vel) {
+    FixedPose fixed(pose);
+    FixedWheelVelocity fixed_vel(vel);
+    x_[i] = fixed.x.raw();
+    y_[i] = fixed.y.raw();
+    theta_[i] = fixed.theta;
+    left_[i] = fixed_vel.left.raw();
+    right_[i] = fixed_vel.right.raw();
+  }
+
+  /**
+   * @brief The pose held in a slot, exactly.
+   */
+  Pose get_pose(size_t i) const {
+    return Pose(Fixed::FromRaw(x_[i]).ToDouble(),
+                Fixed::FromRaw(y_[i]).ToDouble(), AngleToDegrees(theta_[i]));
+  }
+
+  /**
+   * @brief The Heading matching get_pose(i).theta, from the sine table.
+   */
+  Heading get_heading(size_t i) const {
+    const int32_t *table = FixedSinTable();
+    return Heading(deg2rad(AngleToDegrees(theta_[i])),
+                   FixedCos(table, theta_[i]).ToDouble(),
+                   FixedSin(table, theta_[i]).ToDouble());
+  }
+
+  /**
+   * @brief Advance the poses in slots [begin, end) by `dt`, rounded to
+   * Q16.16.
+   */
+  void Integrate(size_t begin, size_t end, double dt);
+
+ private:
+  std::vector<int32_t> x_;
+  std::vector<int32_t> y_;
+  std::vector<FixedAngle> theta_;
+  std::vector<int32_t> left_;
+  std::vector<int32_t> right_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_FIXED_DIFFERENTIAL_INTEGRATOR_H_
@@ -0,0 +1,94 @@
+/**
+ * @file fixed_point.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/fixed_point.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+// table entries per quarter turn
+static const int kQuarter = 256;
+// pi/2 in Q4.28, rounded
+static const int64_t kHalfPiQ28 = 421657428;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+// sin(k/kQuarter * pi/2) in Q16.16 for k in [0, kQuarter], from the Taylor
+// series in Q4.28. Seven terms leave an error below 2^-28 on [0, pi/2], and
+// every value is non-negative, so the shifts and divisions are exact
+// integer operations with no implementation defined cases.
+static int32_t QuarterSin(int64_t k) {
+  int64_t x = (k * kHalfPiQ28 + kQuarter / 2) / kQuarter;
+  int64_t x2 = x * x >> 28;
+  int64_t term = x;
+  int64_t sum = x;
+  for (int64_t n = 1; n <= 7; ++n) {
+    term = term * x2 / (1LL << 28) / ((2 * n) * (2 * n + 1));
+    sum += (n % 2) ? -term : term;
+  }
+  return static_cast<int32_t>((sum + (1 << 11)) >> 12);
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+FixedPose::FixedPose(const Pose &pose)
+  : x(Fixed::FromDouble(pose.x)),
+    y(Fixed::FromDouble(pose.y)),
+    theta(DegreesToAngle(pose.theta)) {}
+
+Pose FixedPose::ToPose() const {
+  return Pose(x.ToDouble(), y.ToDouble(), AngleToDegrees(theta));
+}
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+const int32_t *FixedSinTable() {
+  struct Table {
+    Table() : sin() {
+      // one quarter by the series, the rest by symmetry, so the table is
+      // exactly odd and periodic
+      for (int k = 0; k <= kQuarter; ++k) {
+        int32_t s = QuarterSin(k);
+        sin[k] = s;
+        sin[2 * kQuarter - k] = s;
+        sin[2 * kQuarter + k] = -s;
+        sin[4 * kQuarter - k] = -s;
+      }
+    }
+    int32_t sin[4 * kQuarter + 1];
+  };
+  static const Table table;
+  return table.sin;
+}
+
+uint64_t IntegerSqrt(uint64_t value) {
+  uint64_t root = 0;
+  uint64_t bit = 1ULL << 62;
+  while (bit > value) bit >>= 2;
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+NAMESPACE_END(csci3081);
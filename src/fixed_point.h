@@ -0,0 +1,214 @@
+/**
+ * @file fixed_point.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_FIXED_POINT_H_
+#define SRC_FIXED_POINT_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cmath>
+#include <cstdint>
+
+#include "src/common.h"
+#include "src/pose.h"
+#include "src/wheel_velocity.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief A signed Q16.16 fixed point number: an int32_t counting 2^-16ths.
+ *
+ * Every operation is integer arithmetic with a stated rounding, so a result
+ * is the same bits on every compiler, flag set and CPU. The range is about
+ * +/-32768 with a resolution of 1.5e-5, which covers any arena coordinate.
+ * Products and quotients go through 64 bits, and right shifts of negative
+ * values are arithmetic, as on every supported compiler (and required from
+ * C++20).
+ */
+class Fixed {
+ public:
+  static constexpr int kFracBits = 16;
+  static constexpr int32_t kOne = 1 << kFracBits;
+
+  constexpr Fixed() : raw_(0) {}
+
+  /**
+   * @brief The Fixed holding `raw` 2^-16ths.
+   */
+  static constexpr Fixed FromRaw(int32_t raw) { return Fixed(raw); }
+
+  /**
+   * @brief `value` rounded to the nearest 2^-16.
+   */
+  static Fixed FromDouble(double value) {
+    return Fixed(static_cast<int32_t>(std::lround(value * kOne)));
+  }
+
+  /**
+   * @brief The exact value as a double.
+   */
+  constexpr double ToDouble() const {
+    return static_cast<double>(raw_) / kOne;
+  }
+
+  constexpr int32_t raw() const { return raw_; }
+
+  Fixed operator+(Fixed other) const { return Fixed(raw_ + other.raw_); }
+  Fixed operator-(Fixed other) const { return Fixed(raw_ - other.raw_); }
+  Fixed operator-() const { return Fixed(-raw_); }
+
+  /**
+   * @brief Product, rounded half up.
+   */
+  Fixed operator*(Fixed other) const {
+    return Fixed(static_cast<int32_t>(
+      (static_cast<int64_t>(raw_) * other.raw_ + (kOne >> 1)) >> kFracBits));
+  }
+
+  /**
+   * @brief Quotient, truncated toward zero. `other` must not be zero.
+   */
+  Fixed operator/(Fixed other) const {
+    return Fixed(static_cast<int32_t>(
+      static_cast<int64_t>(raw_) * kOne / other.raw_));
+  }
+
+  bool operator==(Fixed other) const { return raw_ == other.raw_; }
+  bool operator!=(Fixed other) const { return raw_ != other.raw_; }
+  bool operator<(Fixed other) const { return raw_ < other.raw_; }
+  bool operator<=(Fixed other) const { return raw_ <= other.raw_; }
+
+ private:
+  explicit constexpr Fixed(int32_t raw) : raw_(raw) {}
+
+  int32_t raw_;
+};
+
+/**
+ * @brief A binary angle: the full turn is 2^32, so angles wrap for free.
+ */
+typedef uint32_t FixedAngle;
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief A Pose in fixed point, the heading as a FixedAngle.
+ */
+struct FixedPose {
+  FixedPose() : x(), y(), theta(0) {}
+  explicit FixedPose(const Pose &pose);
+
+  /**
+   * @brief The exact Pose this holds, theta in [0, 360).
+   */
+  Pose ToPose() const;
+
+  Fixed x;
+  Fixed y;
+  FixedAngle theta;
+};
+
+/**
+ * @brief A WheelVelocity in fixed point.
+ */
+struct FixedWheelVelocity {
+  FixedWheelVelocity() : left(), right() {}
+  explicit FixedWheelVelocity(const WheelVelocity &vel)
+    : left(Fixed::FromDouble(vel.left)), right(Fixed::FromDouble(vel.right)) {}
+
+  Fixed left;
+  Fixed right;
+};
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief The sine table behind FixedSin(): FixedSin() of every multiple of
+ * 2^22 (1/1024 of a turn), in Q16.16, with one extra entry so that index
+ * 1024 (a full turn) can be read without wrapping.
+ *
+ * It is built on first use with integer arithmetic only (a Taylor series in
+ * Q4.28), never from the C library, so it is identical everywhere.
+ */
+const int32_t *FixedSinTable();
+
+/**
+ * @brief sin(`angle`) in Q16.16 from `table` (FixedSinTable()), linearly
+ * interpolated. The error is under 1e-5.
+ */
+inline Fixed FixedSin(const int32_t *table, FixedAngle angle) {
+  uint32_t index = angle >> 22;
+  int32_t frac = static_cast<int32_t>((angle >> 6) & 0xFFFF);
+  int32_t low = table[index];
+  int32_t step = table[index + 1] - low;
+  return Fixed::FromRaw(low + ((step * frac + (1 << 15)) >> 16));
+}
+
+/**
+ * @brief cos(`angle`) in Q16.16; see FixedSin().
+ */
+inline Fixed FixedCos(const int32_t *table, FixedAngle angle) {
+  return FixedSin(table, angle + (1u << 30));
+}
+
+/**
+ * @brief An angle in radians as a FixedAngle, wrapped to one turn.
+ *
+ * The product is taken in unsigned 64 bit arithmetic, which only differs
+ * from the signed one above the bits that are kept.
+ */
+inline FixedAngle RadiansToAngle(Fixed radians) {
+  // 2^32 / (2 pi), rounded
+  const uint64_t kTurnPerRadian = 683565276;
+  return static_cast<FixedAngle>(
+    (static_cast<uint64_t>(static_cast<int64_t>(radians.raw())) *
+     kTurnPerRadian) >> 16);
+}
+
+/**
+ * @brief An angle in degrees as a FixedAngle, rounded and wrapped.
+ */
+inline FixedAngle DegreesToAngle(double degrees) {
+  return static_cast<FixedAngle>(static_cast<uint64_t>(
+    std::llround(std::fmod(degrees, 360.0) * (4294967296.0 / 360.0))));
+}
+
+/**
+ * @brief A FixedAngle in degrees, in [0, 360). Exact.
+ */
+inline double AngleToDegrees(FixedAngle angle) {
+  return angle * (360.0 / 4294967296.0);
+}
+
+/**
+ * @brief floor(sqrt(`value`)), by integer bisection of the bits.
+ */
+uint64_t IntegerSqrt(uint64_t value);
+
+/**
+ * @brief Whether two circles touch, exactly: the squared distance and the
+ * squared radius sum are compared in 64 bit integers, with no square root.
+ */
+inline bool FixedCirclesTouch(const FixedPose &a, Fixed radius_a,
+                              const FixedPose &b, Fixed radius_b) {
+  int64_t dx = static_cast<int64_t>(b.x.raw()) - a.x.raw();
+  int64_t dy = static_cast<int64_t>(b.y.raw()) - a.y.raw();
+  int64_t reach = static_cast<int64_t>(radius_a.raw()) + radius_b.raw();
+  return dx * dx + dy * dy <= reach * reach;
+}
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_FIXED_POINT_H_
@@ -25,12 +25,18 @@ Food::Food() : ArenaImmobileEntity() {
   set_radius(FOOD_RADIUS);
 }
 
+Food::Food(const Pose &pose) : ArenaImmobileEntity() {
+  set_type(kFood);
+  set_color(FOOD_COLOR);
+  set_pose(pose);
+  set_radius(FOOD_RADIUS);
+}
+
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 void Food::Reset() {
-  set_color(FOOD_COLOR);
-  set_pose(SetPoseRandomlyAux());
+  // food holds no state beyond its place, which the EntityFactory sets
 } /* Reset */
 
 NAMESPACE_END(csci3081);
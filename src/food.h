@@ -15,6 +15,7 @@
 #include "src/arena_immobile_entity.h"
 #include "src/common.h"
 #include "src/entity_type.h"
+#include "src/memory_accounting.h"
 
 /*******************************************************************************
  * Namespaces
@@ -36,7 +37,8 @@ NAMESPACE_BEGIN(csci3081);
  * events.
  *
  */
-class Food : public ArenaImmobileEntity {
+class Food : public ArenaImmobileEntity,
+             private Accounted<Food, kAccountFood> {
  public:
   /**
    * @brief Constructor.
@@ -46,9 +48,16 @@ class Food : public ArenaImmobileEntity {
    */
   Food();
 
+  /**
+   * @brief Constructor used by EntityFactory.
+   *
+   * @param pose The initial pose.
+   */
+  explicit Food(const Pose &pose);
+
   /**
    * @brief Reset the Food using the initialization parameters received
-   * by the constructor.
+   * by the constructor. The Arena's EntityFactory then places it again.
    */
   void Reset() override;
 
@@ -18,7 +18,7 @@
 #include "src/params.h"
 #include "src/pose.h"
 #include "src/rgb_color.h"
-#include "src/robot.h"
+#include "src/memory_accounting.h"
 
 /*******************************************************************************
  * Namespaces
@@ -27,7 +27,8 @@ NAMESPACE_BEGIN(csci3081);
 
 class Robot;
 
-class FoodSensor : public Sensor {
+class FoodSensor : public Sensor,
+                   private Accounted<FoodSensor, kAccountFoodSensor> {
  public:
   /**
    * @brief Constructor using initialization values from params.h.
@@ -7,6 +7,7 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstdio>
 #include <vector>
 #include <iostream>
 
@@ -31,7 +32,8 @@ GraphicsArenaViewer::GraphicsArenaViewer(
     params->y_dim,
     "Robot Simulation"),
   controller_(controller),
-  arena_(arena) {
+  arena_(arena),
+  params_(*params) {
   auto *gui = new nanogui::FormHelper(screen());
   nanogui::ref<nanogui::Window> window =
     gui->addWindow(
@@ -53,6 +55,25 @@ GraphicsArenaViewer::GraphicsArenaViewer(
       std::bind(&GraphicsArenaViewer::OnResetBtnPressed, this));
   reset_button_->setFixedWidth(100);
 
+  /********************SPEED CONTROL***************************/
+  gui->addGroup("Speed");
+  nanogui::Widget *speed_panel = new nanogui::Widget(window);
+  speed_panel->setLayout(new nanogui::BoxLayout(
+    nanogui::Orientation::Horizontal, nanogui::Alignment::Middle, 0, 4));
+
+  // 0 stands for "as fast as the frame budget allows"
+  const int speeds[] = {1, 4, 16, 0};
+  for (int speed : speeds) {
+    nanogui::Button *button = new nanogui::Button(speed_panel,
+      speed > 0 ? std::to_string(speed) + "x" : "Max");
+    button->setFlags(nanogui::Button::RadioButton);
+    button->setPushed(speed == 1);
+    button->setFixedWidth(38);
+    button->setCallback([this, speed]() { OnSpeedBtnPressed(speed); });
+  }
+
+  speed_label_ = new nanogui::Label(window, "Achieved: 1.0x", "sans-bold");
+
   gui->addGroup("Arena Configuration");
 
   /********************ROBOT SLIDERS***************************/
@@ -65,14 +86,14 @@ GraphicsArenaViewer::GraphicsArenaViewer(
   nanogui::Slider *slider = new nanogui::Slider(panel);
   // The starting value (range is from 0 to 1)
   // Note that below the displayed value is 10* slider value.
-  slider->setValue(static_cast<float>(ROBOT_FEAR)/MAX_ROBOT);
+  slider->setValue(static_cast<float>(params_.n_fear_robots)/MAX_ROBOT);
   slider->setFixedWidth(100);
 
   // Display the corresponding value of the slider in this textbox
   nanogui::TextBox *textBox = new nanogui::TextBox(panel);
   textBox->setFixedSize(nanogui::Vector2i(60, 25));
   textBox->setFontSize(20);
-  textBox->setValue(std::to_string(static_cast<int>(ROBOT_FEAR)));
+  textBox->setValue(std::to_string(params_.n_fear_robots));
 
   // This is the lambda function called while the user is moving the slider
   slider->setCallback(
@@ -89,14 +110,14 @@ GraphicsArenaViewer::GraphicsArenaViewer(
   nanogui::Slider *slider2 = new nanogui::Slider(panel);
   // The starting value (range is from 0 to 1)
   // Note that below the displayed value is 10* slider value.
-  slider2->setValue(static_cast<float>(ROBOT_EXPLORE)/MAX_ROBOT);
+  slider2->setValue(static_cast<float>(params_.n_explore_robots)/MAX_ROBOT);
   slider2->setFixedWidth(100);
 
   // Display the corresponding value of the slider in this textbox
   nanogui::TextBox *textBox2 = new nanogui::TextBox(panel);
   textBox2->setFixedSize(nanogui::Vector2i(60, 25));
   textBox2->setFontSize(20);
-  textBox2->setValue(std::to_string(static_cast<int>(ROBOT_EXPLORE)));
+  textBox2->setValue(std::to_string(params_.n_explore_robots));
 
   // This is the lambda function called while the user is moving the slider
   slider2->setCallback(
@@ -114,14 +135,14 @@ GraphicsArenaViewer::GraphicsArenaViewer(
   nanogui::Slider *slider3 = new nanogui::Slider(panel);
   // The starting value (range is from 0 to 1)
   // Note that below the displayed value is 10* slider value.
-  slider3->setValue(static_cast<float>(ROBOT_AGGRESSIVE)/MAX_ROBOT);
+  slider3->setValue(static_cast<float>(params_.n_aggressive_robots)/MAX_ROBOT);
   slider3->setFixedWidth(100);
 
   // Display the corresponding value of the slider in this textbox
   nanogui::TextBox *textBox3 = new nanogui::TextBox(panel);
   textBox3->setFixedSize(nanogui::Vector2i(60, 25));
   textBox3->setFontSize(20);
-  textBox3->setValue(std::to_string(static_cast<int>(ROBOT_AGGRESSIVE)));
+  textBox3->setValue(std::to_string(params_.n_aggressive_robots));
 
   // This is the lambda function called while the user is moving the slider
   slider3->setCallback(
@@ -138,14 +159,14 @@ GraphicsArenaViewer::GraphicsArenaViewer(
   new nanogui::Label(panel, "# of Love Robots", "sans-bold");
   nanogui::Slider *slider4 = new nanogui::Slider(panel);
 
-  slider4->setValue(static_cast<float>(ROBOT_LOVE)/MAX_ROBOT);
+  slider4->setValue(static_cast<float>(params_.n_love_robots)/MAX_ROBOT);
   slider4->setFixedWidth(100);
 
   // Display the corresponding value of the slider in this textbox
   nanogui::TextBox *textBox4 = new nanogui::TextBox(panel);
   textBox4->setFixedSize(nanogui::Vector2i(60, 25));
   textBox4->setFontSize(20);
-  textBox4->setValue(std::to_string(static_cast<int>(ROBOT_LOVE)));
+  textBox4->setValue(std::to_string(params_.n_love_robots));
 
   // This is the lambda function called while the user is moving the slider
   slider4->setCallback(
@@ -161,13 +182,13 @@ GraphicsArenaViewer::GraphicsArenaViewer(
   // LIGHTS SLIDER
   new nanogui::Label(panel, "# of Lights", "sans-bold");
   nanogui::Slider *slider5 = new nanogui::Slider(panel);
-  slider5->setValue(static_cast<float>(N_LIGHTS)/MAX_NUM_LIGHTS);
+  slider5->setValue(static_cast<float>(params_.n_lights)/MAX_NUM_LIGHTS);
   slider5->setFixedWidth(100);
 
   nanogui::TextBox *textBox5 = new nanogui::TextBox(panel);
   textBox5->setFixedSize(nanogui::Vector2i(60, 25));
   textBox5->setFontSize(20);
-  textBox5->setValue(std::to_string(static_cast<int>(N_LIGHTS)));
+  textBox5->setValue(std::to_string(params_.n_lights));
 
   slider5->setCallback(
     [textBox5](float value) {
@@ -187,13 +208,13 @@ GraphicsArenaViewer::GraphicsArenaViewer(
   /***********************FOOD CHANGES************************/
   new nanogui::Label(panel, "# of Food", "sans-bold");
   nanogui::Slider *slider6 = new nanogui::Slider(panel);
-  slider6->setValue(static_cast<float>(N_FOOD)/MAX_FOOD);
+  slider6->setValue(static_cast<float>(params_.n_foods)/MAX_FOOD);
   slider6->setFixedWidth(100);
 
   nanogui::TextBox *textBox6 = new nanogui::TextBox(panel);
   textBox6->setFixedSize(nanogui::Vector2i(60, 25));
   textBox6->setFontSize(20);
-  textBox6->setValue(std::to_string(static_cast<int>(N_FOOD)));
+  textBox6->setValue(std::to_string(params_.n_foods));
 
   slider6->setCallback(
     [textBox6](float value) {
@@ -247,8 +268,14 @@ GraphicsArenaViewer::GraphicsArenaViewer(
 // This is the primary driver for state change in the arena.
 // It will be called at each iteration of nanogui::mainloop()
 void GraphicsArenaViewer::UpdateSimulation(double dt) {
-  if (arena_->get_game_status() == PLAYING)
+  if (arena_->get_game_status() == PLAYING) {
     controller_->AdvanceTime(dt);
+
+    char caption[32];
+    snprintf(caption, sizeof(caption), "Achieved: %.1fx",
+             controller_->get_achieved_speed());
+    speed_label_->setCaption(caption);
+  }
 }
 
 /*******************************************************************************
@@ -283,14 +310,18 @@ void GraphicsArenaViewer::OnFoodTogglePressed() {
     controller_->ChangeNumFood(0);
     controller_->FlipRobotHunger(false);
     food_button_->setCaption("Food ON");
-  } else {  // turn on food, and set to default from params
+  } else {  // turn on food, and restore the scenario's count
     food_stat_ = true;
-    controller_->ChangeNumFood(N_FOOD);
+    controller_->ChangeNumFood(static_cast<int>(params_.n_foods));
     controller_->FlipRobotHunger(true);
     food_button_->setCaption("Food OFF");
   }
 }
 
+void GraphicsArenaViewer::OnSpeedBtnPressed(double speed) {
+  controller_->set_speed(speed);
+}
+
 /** OnSpecialKeyDown is called when the user presses down on one of the
   * special keys (e.g. the arrow keys).
   */
@@ -315,7 +346,7 @@ void GraphicsArenaViewer::OnSpecialKeyDown(int key,
  * Drawing of Entities in Arena
  ******************************************************************************/
 void GraphicsArenaViewer::DrawRobot(NVGcontext *ctx,
-                  const std::vector<class Robot *> robot_vec) {
+                  const EntityView<Robot> &robot_vec) {
   for (unsigned int i = 0; i < robot_vec.size(); i++) {
     // translate and rotate all graphics calls that follow so that they are
     // centered, at the position and heading of this robot
@@ -324,8 +355,7 @@ void GraphicsArenaViewer::DrawRobot(NVGcontext *ctx,
                  static_cast<float>(robot_vec[i]->get_pose().x),
                  static_cast<float>(robot_vec[i]->get_pose().y));
     nvgRotate(ctx,
-              static_cast<float>(robot_vec[i]->get_pose().theta *
-                M_PI / 180.0));
+              static_cast<float>(robot_vec[i]->get_heading().radians));
 
     // robot's circle
     nvgBeginPath(ctx);
@@ -416,31 +446,31 @@ void GraphicsArenaViewer::DrawUsingNanoVG(NVGcontext *ctx) {
   nvgFontFace(ctx, "sans-bold");
   nvgTextAlign(ctx, NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
   DrawArena(ctx);
-  std::vector<ArenaEntity *> entities = arena_->get_entities();
-  for (auto &entity : entities) {
+  // Views read straight out of the arena's vectors, nothing is copied
+  for (auto entity : arena_->entities()) {
     DrawEntity(ctx, entity);
   } /* for(i..) */
-  DrawRobot(ctx, arena_->Robot_Vector());
+  DrawRobot(ctx, arena_->robots());
 
   if (arena_->get_game_status() == WON) {
     nvgFontSize(ctx, 100.0f);
     nvgText(ctx,
-            static_cast<float>(X_DIM / 2),
-            static_cast<float>(Y_DIM / 2.2),
+            static_cast<float>(params_.x_dim / 2),
+            static_cast<float>(params_.y_dim / 2.2),
             "That's a W! :)", nullptr);
     nvgText(ctx,
-            static_cast<float>(X_DIM / 2),
-            static_cast<float>(Y_DIM / 1.5),
+            static_cast<float>(params_.x_dim / 2),
+            static_cast<float>(params_.y_dim / 1.5),
             "\"New Game\" to restart.", nullptr);
   } else if (arena_->get_game_status() == LOST) {
     nvgFontSize(ctx, 100.0f);
     nvgText(ctx,
-            static_cast<float>(X_DIM / 2),
-            static_cast<float>(Y_DIM / 2.2),
+            static_cast<float>(params_.x_dim / 2),
+            static_cast<float>(params_.y_dim / 2.2),
             "One of the Robot's Starved to Death! :/", nullptr);
     nvgText(ctx,
-            static_cast<float>(X_DIM / 2),
-            static_cast<float>(Y_DIM / 1.5),
+            static_cast<float>(params_.x_dim / 2),
+            static_cast<float>(params_.y_dim / 1.5),
             "\"New Game\" to restart.", nullptr);
   }
 }
@@ -14,9 +14,11 @@
 #include <vector>
 
 #include "src/arena.h"
+#include "src/arena_params.h"
 #include "src/controller.h"
 #include "src/common.h"
 #include "src/communication.h"
+#include "src/entity_view.h"
 #include "src/light_sensor.h"
 #include "src/params.h"
 
@@ -103,6 +105,14 @@ class GraphicsArenaViewer : public GraphicsApp {
    */
   void OnFoodTogglePressed();
 
+  /**
+   * @brief Handle the user pressing one of the speed buttons on the GUI.
+   *
+   * @param speed The requested speed multiplier, or 0 for as fast as the
+   * frame budget allows.
+   */
+  void OnSpeedBtnPressed(double speed);
+
   /**
    * @brief Called each time the mouse moves on the screen within the GUI
    * window.
@@ -225,9 +235,9 @@ class GraphicsArenaViewer : public GraphicsApp {
    * should probably only be called from with DrawUsingNanoVG.
    *
    * @param[in] ctx The `nanovg` context.
-   * @param[in] robot The Robot handle.
+   * @param[in] robot_vec Read-only view over the robots in the Arena.
    */
-  void DrawRobot(NVGcontext *ctx, const std::vector<class Robot *> robot_vec);
+  void DrawRobot(NVGcontext *ctx, const EntityView<Robot> &robot_vec);
 
   /**
    * @brief Draw an Light in the Arena using `nanogui`.
@@ -242,12 +252,16 @@ class GraphicsArenaViewer : public GraphicsApp {
 
   Controller *controller_;
   Arena *arena_;
+  // the scenario the arena was built from; the controls start from it
+  struct arena_params params_;
   bool food_stat_{true};
 
   // buttons
   nanogui::Button *playing_button_{nullptr};
   nanogui::Button *reset_button_{nullptr};
   nanogui::Button *food_button_{nullptr};
+  // shows the speed multiplier actually achieved
+  nanogui::Label *speed_label_{nullptr};
 };
 
 NAMESPACE_END(csci3081);
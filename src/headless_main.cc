@@ -0,0 +1,157 @@
+/**
+ * @file headless_main.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "src/arena_params.h"
+#include "src/ensemble_runner.h"
+#include "src/evolution_runner.h"
+#include "src/motion_benchmark.h"
+#include "src/runner_options.h"
+#include "src/simulation_runner.h"
+#include "src/sweep_runner.h"
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+static void Usage(const char *prog) {
+  std::cerr << "usage: " << prog << " [config=FILE] [key=value ...]\n"
+            << "  config=FILE   load a scenario file first; later keys\n"
+            << "                override it\n"
+            << "  ticks=N       maximum ticks to run (default 10000)\n"
+            << "  lights=N      number of lights\n"
+            << "  foods=N       number of food\n"
+            << "  fear=N        number of fear robots\n"
+            << "  aggressive=N  number of aggressive robots\n"
+            << "  explore=N     number of explore robots\n"
+            << "  love=N        number of love robots\n"
+            << "  neural=N      number of neural network robots (needs\n"
+            << "                neural_weights)\n"
+            << "  hunger=X      ticks until a robot is hungry\n"
+            << "  starve=X      ticks until a robot is starving\n"
+            << "  death=X       ticks until a robot starves to death\n"
+            << "  max_sens=X    wheel bias of love/explore robots\n"
+            << "  numerator=N   light sensor numerator\n"
+            << "  any other scenario setting, e.g. light_speed=X or\n"
+            << "  fear_color=R,G,B (see arena_config.h)\n"
+            << "  fear_matrix=12 numbers (see behavior_matrix.h)\n"
+            << "  neural_weights=FILE (see neural_network.h)\n"
+            << "  threads=N     threads (0 = all hardware threads)\n"
+            << "  seed=N        placement seed (0 = from the current time)\n"
+            << "  event_driven=0|1  skip contact checks for entities that\n"
+            << "                cannot touch anything yet (default 1)\n"
+            << "  adaptive_step=0|1  cover several ticks per step while\n"
+            << "                wheel velocities change slowly (default 0)\n"
+            << "  step_tolerance=X  position error an adaptive step may\n"
+            << "                make (default 0.25)\n"
+            << "  max_step_ticks=N  longest adaptive step (default 16)\n"
+            << "  ballistic_lights=0|1  place cruising lights on their\n"
+            << "                straight path without integrating; changes\n"
+            << "                results (default 0)\n"
+            << "  fixed_point=0|1  move and collide in Q16.16 fixed point,\n"
+            << "                bit identical on every platform (default 0)\n"
+            << "  replicas=N    run N differently seeded replicas and\n"
+            << "                summarise them (seeds seed, seed+1, ...)\n"
+            << "  bench=N       time virtual against static dispatch of the\n"
+            << "                motion models over N entities for `ticks`\n"
+            << "  step_bench=0|1  time UpdateEntitiesTimestep over exactly\n"
+            << "                `ticks` ticks of the scenario\n"
+            << "sweeps (replicas are per configuration):\n"
+            << "  sweep.NAME=MIN:MAX[:STEPS]  sweep a tunable above\n"
+            << "  design=grid|random          (default grid)\n"
+            << "  samples=N     configurations of a random design\n"
+            << "  out=FILE      result CSV, resumed if it exists\n"
+            << "evolution (replicas are per genome, statistics stream to\n"
+            << "stdout as CSV):\n"
+            << "  evolve.NAME=MIN:MAX  search a tunable above, e.g.\n"
+            << "                fear_matrix.3=-1:1 (see arena_config.h)\n"
+            << "  population=N  genomes per generation (default 16)\n"
+            << "  generations=N generations to run (default 10)\n";
+}
+
+int main(int argc, char **argv) {
+  csci3081::RunnerOptions options;
+  std::string error;
+  csci3081::RunnerOptionsStatus status =
+    csci3081::ParseRunnerOptions(argc, argv, &options, &error);
+  if (status != csci3081::kOptionsOk) {
+    std::cerr << error << "\n";
+    if (status == csci3081::kOptionsBadArgument) Usage(argv[0]);
+    return 1;
+  }
+  const struct csci3081::arena_params &aparams = options.params;
+  unsigned long ticks = options.ticks;
+  unsigned int replicas = options.replicas;
+  const std::vector<csci3081::SweepDimension> &genes = options.genes;
+  const std::string &out = options.out;
+
+  if (options.bench > 0) {
+    csci3081::ReportMotionBenchmark(
+      csci3081::RunMotionBenchmark(options.bench,
+                                   static_cast<unsigned int>(ticks)),
+      std::cout);
+    return 0;
+  }
+
+  if (options.step_bench) {
+    csci3081::SimulationRunner runner(&aparams);
+    runner.Report(runner.Benchmark(ticks), std::cout);
+    return 0;
+  }
+
+  unsigned int seed = aparams.seed > 0 ? aparams.seed : 1;
+  if (!options.dims.empty()) {
+    csci3081::SweepRunner sweep(aparams, options.dims, options.design,
+                                options.samples,
+                                replicas > 0 ? replicas : 1, ticks, seed,
+                                aparams.n_threads);
+    int ran = sweep.Run(out);
+    if (ran == -2) {
+      std::cerr << out << " holds a different sweep; remove it or pick "
+                << "another out=FILE\n";
+      return 1;
+    }
+    if (ran < 0) {
+      std::cerr << "cannot open " << out << "\n";
+      return 1;
+    }
+    std::cout << "ran " << ran << " of " << sweep.num_configs()
+              << " configurations into " << out << "\n";
+    return 0;
+  }
+
+  if (!genes.empty()) {
+    csci3081::EvolutionRunner evolution(aparams, genes, options.population,
+                                        replicas > 0 ? replicas : 1, ticks,
+                                        seed, aparams.n_threads);
+    csci3081::EvolutionStats best =
+      evolution.Run(options.generations, std::cout);
+    std::cout << "# best fitness " << best.best << ":";
+    for (size_t d = 0; d < genes.size(); d++) {
+      std::cout << " " << genes[d].name << "=" << best.best_genome[d];
+    }
+    std::cout << "\n";
+    return 0;
+  }
+
+  if (replicas > 0) {
+    csci3081::EnsembleRunner ensemble(aparams, replicas, ticks, seed,
+                                      aparams.n_threads);
+    csci3081::EnsembleSummary summary = ensemble.Run();
+    csci3081::EnsembleRunner::Report(summary, std::cout);
+    return 0;
+  }
+
+  csci3081::SimulationRunner runner(&aparams);
+  csci3081::RunResult result = runner.Run(ticks);
+  runner.Report(result, std::cout);
+  return 0;
+}
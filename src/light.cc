@@ -7,6 +7,9 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
+#include <cmath>
+
 #include "src/light.h"
 #include "src/params.h"
 
@@ -20,43 +23,84 @@ NAMESPACE_BEGIN(csci3081);
  ******************************************************************************/
 Light::Light() :
   motion_behavior_(this),
-  collision_timer_(0),
+  arc_ticks_(0),
   collision_cond_(false) {
+  set_speed(LIGHT_SPEED);
   set_color(OBSTACLE_COLOR);
   set_pose(OBSTACLE_POSITION);
   set_radius(OBSTACLE_RADIUS);
   set_type(kLight);
 }
 
+Light::Light(const Pose &pose, double radius) :
+  motion_behavior_(this),
+  arc_ticks_(0),
+  collision_cond_(false) {
+  set_speed(LIGHT_SPEED);
+  set_color(OBSTACLE_COLOR);
+  set_pose(pose);
+  set_radius(radius);
+  set_type(kLight);
+}
+
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 void Light::TimestepUpdate(unsigned int dt) {
   motion_behavior_.UpdatePose(dt, get_velocity());
+  FinishStep(dt);
+}
 
+void Light::FinishStep(unsigned int dt) {
   // check if the light has collided with anything
   if (collision_cond_) {
-    double secondsPassed = (clock() - collision_timer_) / CLOCKS_PER_SEC;
-    if (secondsPassed < ARC_TIME) {
-      set_velocity(5.0, 5.0);
+    if (arc_ticks_ > 0) {
+      set_velocity(LIGHT_ARC_SPEED, LIGHT_ARC_SPEED);
       RelativeChangeHeading(-5);
+      arc_ticks_ -= std::min(dt, arc_ticks_);
     } else {
       collision_cond_ = false;
     }
   } else {
-      set_velocity(3.0, 3.0);
+      set_velocity(get_speed(), get_speed());
     }
 }
 
+void Light::Launch(unsigned long tick) {
+  WheelVelocity vel = get_velocity();
+  in_flight_ = !collision_cond_ && !(std::fabs(vel.left - get_speed()) > 0) &&
+               !(std::fabs(vel.right - get_speed()) > 0);
+  flight_origin_ = get_pose();
+  flight_tick_ = tick;
+  flight_dx_ = get_heading().dx * get_speed();
+  flight_dy_ = get_heading().dy * get_speed();
+  flight_pose_ = get_pose();
+  flight_speed_ = get_speed();
+}
+
+bool Light::InFlight() const {
+  const Pose &pose = get_pose();
+  return in_flight_ && !collision_cond_ &&
+         !(std::fabs(pose.x - flight_pose_.x) > 0) &&
+         !(std::fabs(pose.y - flight_pose_.y) > 0) &&
+         !(std::fabs(pose.theta - flight_pose_.theta) > 0) &&
+         !(std::fabs(get_speed() - flight_speed_) > 0);
+}
+
+void Light::Fly(unsigned long tick) {
+  double ticks = static_cast<double>(tick - flight_tick_);
+  set_position(flight_origin_.x + flight_dx_ * ticks,
+               flight_origin_.y + flight_dy_ * ticks);
+  flight_pose_ = get_pose();
+}
+
 void Light::HandleCollision(EntityType object_type,
   ArenaEntity * object) {
   sensor_touch_->HandleCollision(object_type, object);
 }
 
 void Light::Reset() {
-  set_pose(SetPoseRandomlyAux());
-  set_radius(random() % (OBSTACLE_MAX_RADIUS - OBSTACLE_MIN_RADIUS + 1)
-  + OBSTACLE_MIN_RADIUS);
+  in_flight_ = false;
 }
 
 NAMESPACE_END(csci3081);
@@ -10,6 +10,7 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
 #include <string>
 
 #include "src/arena_mobile_entity.h"
@@ -18,7 +19,9 @@
 #include "src/pose.h"
 #include "src/wheel_velocity.h"
 #include "src/motion_handler.h"
-#include "src/motion_behavior_differential.h"
+#include "src/motion_model.h"
+#include "src/memory_accounting.h"
+#include "src/params.h"
 
 
 /*******************************************************************************
@@ -34,13 +37,22 @@ NAMESPACE_BEGIN(csci3081);
  *
  * Since lights are immobile, the Light class is very simple.
  */
-class Light : public ArenaMobileEntity {
+class Light : public ArenaMobileEntity,
+              private Accounted<Light, kAccountLight> {
  public:
   /**
    * @brief Constructor.
    */
   Light();
 
+  /**
+   * @brief Constructor used by EntityFactory.
+   *
+   * @param pose The initial pose.
+   * @param radius The radius of the light.
+   */
+  Light(const Pose &pose, double radius);
+
   /**
    * @brief Get the name of the Light for visualization purposes, and to
    * aid in debugging.
@@ -60,6 +72,16 @@ class Light : public ArenaMobileEntity {
    */
   void TimestepUpdate(unsigned int dt) override;
 
+  /**
+   * @brief The part of TimestepUpdate() after the pose is integrated: the
+   * collision arc and the velocity for the next tick.
+   *
+   * Moving the pose by get_velocity() then calling FinishStep() is the same
+   * as TimestepUpdate(); the Arena splits it this way to integrate every
+   * light's pose in one DifferentialIntegrator pass.
+   */
+  void FinishStep(unsigned int dt);
+
   /**
   * @brief Command that returns the velocity.
   */
@@ -76,18 +98,41 @@ class Light : public ArenaMobileEntity {
   /**
   * @brief Command that returns the motion_behavior.
   */
-  MotionBehaviorDifferential get_motion_behavior() {return motion_behavior_;}
+  StaticMotionBehavior<DifferentialDriveModel> &get_motion_behavior() {
+    return motion_behavior_;
+  }
 
   /**
    * @brief Reset the Light using the initialization parameters received
-   * by the constructor.
+   * by the constructor. The Arena's EntityFactory then places it again.
    */
   void Reset() override;
 
   /**
    * @brief Sets the collision timer on collision for reverse arc.
    */
-  void set_collision_timer() { collision_timer_ = clock(); }
+  void set_collision_timer() { arc_ticks_ = arc_length_; }
+
+  /**
+   * @brief Set the wheel speed outside the reverse arc.
+   */
+  void set_speed(double sp) override {
+    ArenaMobileEntity::set_speed(sp);
+    set_velocity(sp, sp);
+  }
+
+  /**
+   * @brief Lights drive straight at their speed, or at LIGHT_ARC_SPEED during
+   * the reverse arc.
+   */
+  double get_max_step() const override {
+    return std::max(get_speed(), LIGHT_ARC_SPEED);
+  }
+
+  /**
+   * @brief Set the length of the reverse arc, in ticks.
+   */
+  void set_arc_length(unsigned int ticks) { arc_length_ = ticks; }
 
   /**
    * @brief Set the collision_cond_.
@@ -101,11 +146,46 @@ class Light : public ArenaMobileEntity {
    */
   bool get_collision_cond() { return collision_cond_; }
 
+  /**
+   * @brief Start a ballistic flight from the current pose at `tick`, if
+   * the light is cruising: out of its reverse arc and with both wheels at
+   * its speed.
+   *
+   * A cruising light drives in a straight line, so its pose at any later
+   * tick follows from where and when it started and its move per tick.
+   */
+  void Launch(unsigned long tick);
+
+  /**
+   * @brief Whether the light is on a ballistic flight that nothing has
+   * disturbed since: no collision, no change of speed, and no one else has
+   * moved or turned it.
+   */
+  bool InFlight() const;
+
+  /**
+   * @brief Move the light to where its flight puts it at `tick`. Only valid
+   * while InFlight().
+   */
+  void Fly(unsigned long tick);
+
  private:
-  WheelVelocity velocity_{3.0, 3.0};
-  MotionBehaviorDifferential motion_behavior_;
-  clock_t collision_timer_;
+  WheelVelocity velocity_{LIGHT_SPEED, LIGHT_SPEED};
+  StaticMotionBehavior<DifferentialDriveModel> motion_behavior_;
+  // length of the reverse arc after a collision
+  unsigned int arc_length_{ARC_TICKS};
+  // ticks left in the reverse arc after a collision
+  unsigned int arc_ticks_;
   bool collision_cond_;
+  // ballistic flight: the start pose and tick, the move per tick, and the
+  // pose and speed the flight last left the light with
+  bool in_flight_{false};
+  Pose flight_origin_{};
+  unsigned long flight_tick_{0};
+  double flight_dx_{0};
+  double flight_dy_{0};
+  Pose flight_pose_{};
+  double flight_speed_{0};
 };
 
 NAMESPACE_END(csci3081);
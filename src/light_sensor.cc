@@ -9,6 +9,7 @@
  ******************************************************************************/
 #include "src/light_sensor.h"
 #include "src/params.h"
+#include "src/robot.h"
 
 /*******************************************************************************
  * Namespaces
@@ -22,7 +23,7 @@ LightSensor::LightSensor() {}
 
 LightSensor::LightSensor(Robot *r, double sense_angle) {
   robot_ = r;
-  heading_angle_ = sense_angle;
+  set_heading_angle(sense_angle);
 }
 
 /*******************************************************************************
@@ -38,10 +39,10 @@ void LightSensor::Notify(Pose pose) {
 }
 
 void LightSensor::Update_Pose() {
-  double x = robot_->get_pose().x + robot_->get_radius() *
-    cos(PI * (robot_->get_pose().theta + heading_angle_) / 180);
-  double y = robot_->get_pose().y + robot_->get_radius() *
-    sin(PI * (robot_->get_pose().theta + heading_angle_) / 180);
+  // The robot's heading rotated by the mount angle, without sin or cos
+  Heading dir = robot_->get_heading().Rotated(mount_);
+  double x = robot_->get_pose().x + robot_->get_radius() * dir.dx;
+  double y = robot_->get_pose().y + robot_->get_radius() * dir.dy;
   Pose nPose(x, y);
   this->set_pose(nPose);
 }
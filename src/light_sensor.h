@@ -18,7 +18,7 @@
 #include "src/params.h"
 #include "src/pose.h"
 #include "src/rgb_color.h"
-#include "src/robot.h"
+#include "src/memory_accounting.h"
 
 /*******************************************************************************
  * Namespaces
@@ -36,7 +36,8 @@ class Robot;
  * This class inherits from Sensor and uses an overrided methods
  * to determine the readings for the robot to use to set its velocity.
  */
-class LightSensor : public Sensor {
+class LightSensor : public Sensor,
+                    private Accounted<LightSensor, kAccountLightSensor> {
  public:
   /**
    * @brief Constructor using initialization values from params.h.
@@ -7,8 +7,11 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstring>
 #include <iostream>
+#include <string>
 
+#include "src/arena_config.h"
 #include "src/arena_params.h"
 #include "src/controller.h"
 #include "src/graphics_arena_viewer.h"
@@ -16,9 +19,29 @@
 /*******************************************************************************
  * Non-Member Functions
  ******************************************************************************/
-int main(__unused int argc, __unused char **argv) {
+int main(int argc, char **argv) {
+  // Usage: arenaviewer [SCENARIO_FILE] [name=value ...]
+  csci3081::arena_params aparams;
+  for (int i = 1; i < argc; i++) {
+    const char *eq = std::strchr(argv[i], '=');
+    std::string error = std::string("bad setting ") + argv[i];
+    bool ok = eq == nullptr ?
+      csci3081::LoadArenaParams(argv[i], &aparams, &error) :
+      csci3081::SetArenaParam(std::string(argv[i], eq - argv[i]), eq + 1,
+                              &aparams);
+    if (!ok) {
+      std::cerr << error << "\n";
+      return 1;
+    }
+  }
+  std::string error;
+  if (!csci3081::CheckArenaParams(aparams, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+
   // The controller creates both the arena and viewer
-  auto *controller = new csci3081::Controller;
+  auto *controller = new csci3081::Controller(aparams);
 
   // The controller will call Run of the viewer
   controller->Run();
@@ -0,0 +1,112 @@
+/**
+ * @file memory_accounting.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+
+#include "src/memory_accounting.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+static std::atomic<long> live_count[kAccountKindCount];
+static std::atomic<long> live_size[kAccountKindCount];
+static std::atomic<long> total_count[kAccountKindCount];
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void MemoryAccounting::Allocated(AccountedKind kind, size_t bytes) {
+  live_count[kind].fetch_add(1, std::memory_order_relaxed);
+  live_size[kind].fetch_add(static_cast<long>(bytes),
+                            std::memory_order_relaxed);
+  total_count[kind].fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryAccounting::Released(AccountedKind kind, size_t bytes) {
+  live_count[kind].fetch_sub(1, std::memory_order_relaxed);
+  live_size[kind].fetch_sub(static_cast<long>(bytes),
+                            std::memory_order_relaxed);
+}
+
+long MemoryAccounting::live_objects(AccountedKind kind) {
+  return live_count[kind].load(std::memory_order_relaxed);
+}
+
+long MemoryAccounting::live_bytes(AccountedKind kind) {
+  return live_size[kind].load(std::memory_order_relaxed);
+}
+
+long MemoryAccounting::total_objects(AccountedKind kind) {
+  return total_count[kind].load(std::memory_order_relaxed);
+}
+
+const char *MemoryAccounting::kind_name(AccountedKind kind) {
+  switch (kind) {
+    case kAccountRobot: return "Robot";
+    case kAccountLight: return "Light";
+    case kAccountFood: return "Food";
+    case kAccountLightSensor: return "LightSensor";
+    case kAccountFoodSensor: return "FoodSensor";
+    case kAccountTouchSensor: return "SensorTouch";
+    case kAccountMotionHandler: return "MotionHandlerRobot";
+    case kAccountBehavior: return "RobotBehavior";
+    default: return "Unknown";
+  }
+}
+
+const char *MemoryAccounting::subsystem_name(AccountedKind kind) {
+  switch (kind) {
+    case kAccountRobot:
+    case kAccountLight:
+    case kAccountFood: return "entities";
+    case kAccountLightSensor:
+    case kAccountFoodSensor:
+    case kAccountTouchSensor: return "sensors";
+    case kAccountMotionHandler: return "motion";
+    case kAccountBehavior: return "behaviors";
+    default: return "unknown";
+  }
+}
+
+void MemoryAccounting::Report(std::ostream &os) {
+  os << "Live objects:\n";
+  for (int i = 0; i < kAccountKindCount; i++) {
+    AccountedKind kind = static_cast<AccountedKind>(i);
+    os << "  " << std::left << std::setw(20) << kind_name(kind)
+       << std::right << std::setw(10) << live_objects(kind)
+       << std::setw(12) << live_bytes(kind) << " B"
+       << "  (" << total_objects(kind) << " created)\n";
+  }
+
+  // subsystems are contiguous runs of kinds, so sum each run in order
+  os << "Bytes per subsystem:\n";
+  const char *current = subsystem_name(static_cast<AccountedKind>(0));
+  long bytes = 0;
+  for (int i = 0; i <= kAccountKindCount; i++) {
+    AccountedKind kind = static_cast<AccountedKind>(i);
+    if (i == kAccountKindCount ||
+        std::strcmp(subsystem_name(kind), current) != 0) {
+      os << "  " << std::left << std::setw(20) << current
+         << std::right << std::setw(22) << bytes << " B\n";
+      if (i == kAccountKindCount) break;
+      current = subsystem_name(kind);
+      bytes = 0;
+    }
+    bytes += live_bytes(kind);
+  }
+}
+
+NAMESPACE_END(csci3081);
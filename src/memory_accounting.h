@@ -0,0 +1,142 @@
+/**
+ * @file memory_accounting.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_MEMORY_ACCOUNTING_H_
+#define SRC_MEMORY_ACCOUNTING_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <iostream>
+
+#include "src/common.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/**
+ * @brief The kinds of simulation objects whose allocations are tracked.
+ */
+enum AccountedKind {
+  kAccountRobot, kAccountLight, kAccountFood,
+  kAccountLightSensor, kAccountFoodSensor, kAccountTouchSensor,
+  kAccountMotionHandler, kAccountBehavior,
+  kAccountKindCount
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Process wide bookkeeping of live simulation objects.
+ *
+ * Every tracked object reports itself on construction and destruction (see
+ * Accounted), so the live counts go back to where they started once an
+ * entity and everything it owns have been destroyed. The counters are atomic
+ * and can be updated from any thread.
+ *
+ * Ownership model being accounted for:
+ * - Arena owns its EntityFactory and every entity in its vectors.
+ * - ArenaMobileEntity owns its SensorTouch.
+ * - Robot owns its MotionHandlerRobot and its four sensors, embedded in it.
+ * - MotionHandlerRobot owns its RobotBehavior.
+ *
+ * Each byte is counted once: an object embedded in another reports its own
+ * bytes, and its owner reports only the rest (see AccountedSize).
+ */
+class MemoryAccounting {
+ public:
+  /**
+   * @brief Record that an object of the given kind was constructed.
+   *
+   * @param kind The kind of object.
+   * @param bytes The size of the object.
+   */
+  static void Allocated(AccountedKind kind, size_t bytes);
+
+  /**
+   * @brief Record that an object of the given kind was destroyed.
+   *
+   * @param kind The kind of object.
+   * @param bytes The size of the object.
+   */
+  static void Released(AccountedKind kind, size_t bytes);
+
+  /**
+   * @brief Number of objects of the given kind currently alive.
+   */
+  static long live_objects(AccountedKind kind);
+
+  /**
+   * @brief Number of bytes held by live objects of the given kind.
+   */
+  static long live_bytes(AccountedKind kind);
+
+  /**
+   * @brief Number of objects of the given kind ever constructed.
+   */
+  static long total_objects(AccountedKind kind);
+
+  /**
+   * @brief Human readable name of the kind (e.g. "Robot").
+   */
+  static const char *kind_name(AccountedKind kind);
+
+  /**
+   * @brief Name of the subsystem the kind belongs to (e.g. "sensors").
+   */
+  static const char *subsystem_name(AccountedKind kind);
+
+  /**
+   * @brief Write a table of live objects per kind and bytes per subsystem.
+   *
+   * @param os The stream to write the report to.
+   */
+  static void Report(std::ostream &os);
+};
+
+/**
+ * @brief The bytes an object of type T is accounted with.
+ *
+ * sizeof(T) by default. A class that embeds accounted members specializes
+ * this to leave them out, since they report their own bytes.
+ */
+template <typename T>
+struct AccountedSize {
+  static size_t bytes() { return sizeof(T); }
+};
+
+/**
+ * @brief Mix-in that reports construction and destruction of T to
+ * MemoryAccounting.
+ *
+ * Inherit privately from it, e.g. `private Accounted<Food, kAccountFood>`.
+ * The base is empty so it does not grow the object.
+ *
+ * @tparam T The most derived class being tracked.
+ * @tparam Kind The AccountedKind T is reported as.
+ */
+template <typename T, AccountedKind Kind>
+class Accounted {
+ protected:
+  Accounted() {
+    MemoryAccounting::Allocated(Kind, AccountedSize<T>::bytes());
+  }
+  Accounted(const Accounted &) {
+    MemoryAccounting::Allocated(Kind, AccountedSize<T>::bytes());
+  }
+  Accounted &operator=(const Accounted &) { return *this; }
+  ~Accounted() {
+    MemoryAccounting::Released(Kind, AccountedSize<T>::bytes());
+  }
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_MEMORY_ACCOUNTING_H_
@@ -25,17 +25,16 @@ MotionBehavior::MotionBehavior(ArenaMobileEntity * ent) : entity_(ent) {}
 
 void MotionBehavior::UpdatePose(double dt, __unused WheelVelocity vel) {
   Pose pose = entity_->get_pose();
+  const Heading &heading = entity_->get_heading();
 
   // Movement is always along the heading_angle (i.e. the hypotenuse)
-  double new_x =
-    pose.x + std::cos(pose.theta * M_PI / 180.0) * entity_->get_speed() * dt;
-  double new_y =
-    pose.y + std::sin(pose.theta * M_PI / 180.0) * entity_->get_speed() * dt;
+  double new_x = pose.x + heading.dx * entity_->get_speed() * dt;
+  double new_y = pose.y + heading.dy * entity_->get_speed() * dt;
 
   /* Heading angle remaings the same */
   pose.x = new_x;
   pose.y = new_y;
-  entity_->set_pose(pose);
+  entity_->set_pose(pose, heading);
 } /* UpdatePose() */
 
 NAMESPACE_END(csci3081);
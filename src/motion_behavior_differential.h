@@ -14,6 +14,7 @@
 #include "src/pose.h"
 #include "src/wheel_velocity.h"
 #include "src/motion_behavior.h"
+#include "src/motion_model.h"
 
 /*******************************************************************************
  * Namespaces
@@ -26,13 +27,14 @@ NAMESPACE_BEGIN(csci3081);
 /**
  * @brief A simple model of differential drive kinematics Based on the notes
  * here: ~https://chess.eecs.berkeley.edu/eecs149/documentation/differentialDrive.pdf~
+ *
+ * The virtual face of DifferentialDriveModel (see motion_model.h), for code
+ * that goes through MotionBehavior. Entities hold the model statically.
  */
 class MotionBehaviorDifferential : public MotionBehavior {
  public:
   explicit MotionBehaviorDifferential(ArenaMobileEntity * entity)
-    : MotionBehavior(entity) , radius_(entity_->get_radius()),
-      temp_vel_(0, 0) {
-  }
+    : MotionBehavior(entity) {}
 
   /**
    * @brief Default copy constructor.
@@ -60,33 +62,6 @@ class MotionBehaviorDifferential : public MotionBehavior {
    * heading.)
    */
   void UpdatePose(double dt, WheelVelocity vel) override;
-
- private:
-  /**
-   * @brief Get the radius of the ICC
-   */
-  double icc_radius() const;
-
-  /**
-   * @brief Get the angular velocity, in rad/sec.
-   */
-  double omega() const;
-
-  /**
-   * @brief Get the Instantaneous Center of Curvature (ICC) of the entity.
-   *
-   * @param pose The entities current pose.
-   *
-   * @return The center of curvature (theta component of pose unused).
-   */
-  struct Pose calc_icc(struct Pose pose) const;
-
-  double radius_;
-
-  // Velocity is stored in motion handler. Value is passed in here and used to
-  // calculate new pose. Its used in various functions, hence the temp var
-  // instead of passing it around from function to function.
-  WheelVelocity temp_vel_;
 };
 
 NAMESPACE_END(csci3081);
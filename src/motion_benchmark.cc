@@ -0,0 +1,174 @@
+/**
+ * @file motion_benchmark.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "src/light.h"
+#include "src/motion_benchmark.h"
+#include "src/motion_model.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+// Start pose and velocity of entity i; the same for both runs.
+static void Start(size_t i, Light *ent, WheelVelocity *vel) {
+  ent->set_pose(Pose(500 + (i % 97), 400 + (i % 89), 7.0 * (i % 51)));
+  *vel = WheelVelocity(2.0 + 0.01 * (i % 13), 1.5 + 0.02 * (i % 7));
+}
+
+// Seconds taken by `body`.
+template <class Body>
+static double Time(Body body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+// Model of entity i: the entities are split into four equal blocks.
+static size_t ModelOf(size_t i, size_t entities) { return i * 4 / entities; }
+
+// Append a StaticMotionBehavior for every entity of one block.
+template <class Model>
+static void Group(const std::vector<std::unique_ptr<Light>> &ents,
+                  size_t model,
+                  std::vector<StaticMotionBehavior<Model>> *group) {
+  for (size_t i = 0; i < ents.size(); ++i) {
+    if (ModelOf(i, ents.size()) == model) group->emplace_back(ents[i].get());
+  }
+}
+
+// Advance one block; `first` is the index of its first entity.
+template <class Model>
+static void Advance(std::vector<StaticMotionBehavior<Model>> *group,
+                    size_t first, const std::vector<WheelVelocity> &vel) {
+  for (size_t k = 0; k < group->size(); ++k) {
+    (*group)[k].UpdatePose(1, vel[first + k]);
+  }
+}
+
+// Whether every entity is where `expected` says.
+static bool Agree(const std::vector<std::unique_ptr<Light>> &ents,
+                  const std::vector<Pose> &expected) {
+  for (size_t i = 0; i < ents.size(); ++i) {
+    const Pose &pose = ents[i]->get_pose();
+    if (std::fabs(pose.x - expected[i].x) > 0 ||
+        std::fabs(pose.y - expected[i].y) > 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+MotionBenchmarkResult RunMotionBenchmark(size_t entities,
+                                         unsigned int ticks) {
+  MotionBenchmarkResult result;
+  if (entities < 4 || ticks == 0) return result;
+
+  std::vector<std::unique_ptr<Light>> ents;
+  std::vector<WheelVelocity> vel(entities);
+  std::vector<std::unique_ptr<MotionBehavior>> dynamic;
+  for (size_t i = 0; i < entities; ++i) {
+    ents.emplace_back(new Light());
+    Light *ent = ents.back().get();
+    switch (ModelOf(i, entities)) {
+      case 0: dynamic.emplace_back(
+        new DynamicMotionBehavior<DifferentialDriveModel>(ent));
+        break;
+      case 1: dynamic.emplace_back(
+        new DynamicMotionBehavior<UnicycleModel>(ent));
+        break;
+      case 2: dynamic.emplace_back(
+        new DynamicMotionBehavior<AckermannModel>(ent));
+        break;
+      default: dynamic.emplace_back(
+        new DynamicMotionBehavior<HolonomicModel>(ent));
+    }
+  }
+  // visiting order that changes model on every update, as an entity list
+  // of mixed models would
+  std::vector<size_t> mixed;
+  size_t block = (entities + 3) / 4;
+  for (size_t k = 0; k < block; ++k) {
+    for (size_t m = 0; m < 4; ++m) {
+      if (m * block + k < entities) mixed.push_back(m * block + k);
+    }
+  }
+  auto restart = [&]() {
+    for (size_t i = 0; i < entities; ++i) Start(i, ents[i].get(), &vel[i]);
+  };
+
+  restart();
+  double mixed_s = Time([&]() {
+    for (unsigned int t = 0; t < ticks; ++t) {
+      for (size_t i : mixed) dynamic[i]->UpdatePose(1, vel[i]);
+    }
+  });
+  std::vector<Pose> expected;
+  for (auto &ent : ents) expected.push_back(ent->get_pose());
+
+  restart();
+  double virtual_s = Time([&]() {
+    for (unsigned int t = 0; t < ticks; ++t) {
+      for (size_t i = 0; i < entities; ++i) dynamic[i]->UpdatePose(1, vel[i]);
+    }
+  });
+  result.poses_agree = Agree(ents, expected);
+
+  std::vector<StaticMotionBehavior<DifferentialDriveModel>> differential;
+  std::vector<StaticMotionBehavior<UnicycleModel>> unicycle;
+  std::vector<StaticMotionBehavior<AckermannModel>> ackermann;
+  std::vector<StaticMotionBehavior<HolonomicModel>> holonomic;
+  Group(ents, 0, &differential);
+  Group(ents, 1, &unicycle);
+  Group(ents, 2, &ackermann);
+  Group(ents, 3, &holonomic);
+  size_t first_unicycle = differential.size();
+  size_t first_ackermann = first_unicycle + unicycle.size();
+  size_t first_holonomic = first_ackermann + ackermann.size();
+  restart();
+  double static_s = Time([&]() {
+    for (unsigned int t = 0; t < ticks; ++t) {
+      Advance(&differential, 0, vel);
+      Advance(&unicycle, first_unicycle, vel);
+      Advance(&ackermann, first_ackermann, vel);
+      Advance(&holonomic, first_holonomic, vel);
+    }
+  });
+  result.poses_agree = result.poses_agree && Agree(ents, expected);
+
+  double updates = static_cast<double>(entities) * ticks;
+  result.mixed_virtual_ns = mixed_s * 1e9 / updates;
+  result.virtual_ns = virtual_s * 1e9 / updates;
+  result.static_ns = static_s * 1e9 / updates;
+  return result;
+}
+
+void ReportMotionBenchmark(const MotionBenchmarkResult &result,
+                           std::ostream &out) {
+  out << "virtual, models mixed (ns/update):   " << result.mixed_virtual_ns
+      << "\n"
+      << "virtual, models grouped (ns/update): " << result.virtual_ns << "\n"
+      << "static (ns/update):                  " << result.static_ns << "\n"
+      << "poses agree:                         "
+      << (result.poses_agree ? "yes" : "no") << "\n";
+}
+
+NAMESPACE_END(csci3081);
@@ -0,0 +1,64 @@
+/**
+ * @file motion_benchmark.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_MOTION_BENCHMARK_H_
+#define SRC_MOTION_BENCHMARK_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstddef>
+#include <ostream>
+
+#include "src/common.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief Timings from RunMotionBenchmark(), in nanoseconds per entity update.
+ */
+struct MotionBenchmarkResult {
+  // through a MotionBehavior pointer, the model changing every update
+  double mixed_virtual_ns{0};
+  // through a MotionBehavior pointer, one model after another
+  double virtual_ns{0};
+  // through StaticMotionBehavior, one model after another
+  double static_ns{0};
+  // whether every way left every entity at the same pose
+  bool poses_agree{false};
+};
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief Time virtual against static dispatch of the motion models.
+ *
+ * `entities` entities (at least 4) are split evenly over the four models in
+ * motion_model.h and advanced `ticks` times from the same start three ways:
+ * through DynamicMotionBehavior in an order that switches model on every
+ * call, as a mixed entity list would; through DynamicMotionBehavior one
+ * model at a time; and through StaticMotionBehavior, one loop per model with
+ * no virtual calls. This file is built optimised, so the static loops inline
+ * as they would in an optimised build of the simulation.
+ */
+MotionBenchmarkResult RunMotionBenchmark(size_t entities, unsigned int ticks);
+
+/**
+ * @brief Print a MotionBenchmarkResult.
+ */
+void ReportMotionBenchmark(const MotionBenchmarkResult &result,
+                           std::ostream &out);
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_MOTION_BENCHMARK_H_
@@ -20,6 +20,7 @@ NAMESPACE_BEGIN(csci3081);
  ******************************************************************************/
 
 void MotionHandlerRobot::CreateBehavior(RobotBehaviorEnum behv) {
+  delete behv_;
   switch (behv) {
     case kAggressive: behv_ = new AggressiveBehavior;
       break;
@@ -29,6 +30,8 @@ void MotionHandlerRobot::CreateBehavior(RobotBehaviorEnum behv) {
       break;
     case kFear: behv_ = new FearBehavior;
       break;
+    case kNeural: behv_ = new NeuralBehavior;
+      break;
     default: behv_ = new FearBehavior;
   }
 }
@@ -20,8 +20,10 @@
 #include "src/wheel_velocity.h"
 #include "src/fear_behavior.h"
 #include "src/love_behavior.h"
+#include "src/neural_behavior.h"
 #include "src/explore_behavior.h"
 #include "src/aggressive_behavior.h"
+#include "src/memory_accounting.h"
 
 /*******************************************************************************
  * Namespaces
@@ -38,8 +40,11 @@ NAMESPACE_BEGIN(csci3081);
  *
  * Currently, both wheels are always going at maximum speed, and
  * cannot be controlled independently.
+ *
+ * The handler owns the RobotBehavior created by CreateBehavior.
  */
-class MotionHandlerRobot : public MotionHandler {
+class MotionHandlerRobot final : public MotionHandler,
+    private Accounted<MotionHandlerRobot, kAccountMotionHandler> {
  public:
   /**
    * @brief Default constructor.
@@ -50,17 +55,22 @@ class MotionHandlerRobot : public MotionHandler {
    * @brief Explicit value contructor adds a pointer to the ent .
    */
   explicit MotionHandlerRobot(ArenaMobileEntity * ent)
-    : MotionHandler(ent) {}
+    : MotionHandler(ent), Accounted() {}
+
+  /**
+   * @brief Destructor. `delete` the owned behavior.
+   */
+  ~MotionHandlerRobot() override { delete behv_; }
 
   /**
-   * @brief Default copy constructor.
+   * @brief The handler owns its behavior, so it cannot be copied.
    */
-  MotionHandlerRobot(const MotionHandlerRobot& other) = default;
+  MotionHandlerRobot(const MotionHandlerRobot& other) = delete;
 
   /**
-   * @brief Default = operator overload.
+   * @brief The handler owns its behavior, so it cannot be copied.
    */
-  MotionHandlerRobot& operator=(const MotionHandlerRobot& other) = default;
+  MotionHandlerRobot& operator=(const MotionHandlerRobot& other) = delete;
 
   /**
   * @brief Update the speed and the pose angle.
@@ -110,7 +120,8 @@ class MotionHandlerRobot : public MotionHandler {
   void TurnLeft() override;
 
   /**
-   * @brief Initializes the behv_ member depending on the param
+   * @brief Initializes the behv_ member depending on the param. Any
+   * previously created behavior is destroyed first.
    *
    * @param[in] behv The Enum that determines what the behavior of the
    * robot will be
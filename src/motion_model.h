@@ -0,0 +1,210 @@
+/**
+ * @file motion_model.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_MOTION_MODEL_H_
+#define SRC_MOTION_MODEL_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cmath>
+
+#include "src/arena_mobile_entity.h"
+#include "src/common.h"
+#include "src/differential_drive.h"
+#include "src/motion_behavior.h"
+#include "src/pose.h"
+#include "src/wheel_velocity.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Base of the kinematic models, bound at compile time (CRTP).
+ *
+ * A model is a small value type deriving from MotionModel<itself> with one
+ * const member:
+ *
+ *     void Advance(double dt, const WheelVelocity &vel,
+ *                  Pose *pose, Heading *heading) const;
+ *
+ * which moves `pose` and `heading` on by `dt` ticks with `vel` held fixed,
+ * keeping the two in agreement. UpdatePose() resolves to that Advance()
+ * statically, so a loop over entities of one model has no virtual calls and
+ * the whole update can be inlined. A new model needs nothing but that one
+ * function; wrap it in StaticMotionBehavior to give an entity a fixed model,
+ * or in DynamicMotionBehavior where the model is picked at run time.
+ */
+template <class Model>
+class MotionModel {
+ public:
+  /**
+   * @brief Move `ent` on by `dt` ticks with wheel velocity `vel`.
+   */
+  void UpdatePose(ArenaMobileEntity *ent, double dt,
+                  const WheelVelocity &vel) const {
+    Pose pose = ent->get_pose();
+    Heading heading = ent->get_heading();
+    static_cast<const Model &>(*this).Advance(dt, vel, &pose, &heading);
+    ent->set_pose(pose, heading);
+  }
+
+ protected:
+  /**
+   * @brief The exact arc of a body moving at `speed` along its heading while
+   * turning at `omega` radians per tick, over `dt` ticks.
+   *
+   * The body moves speed * dt * sin(h)/h along the heading turned by h, and
+   * turns by 2h, where h = omega * dt / 2. Only sin and cos of h are needed;
+   * the new heading is the old unit vector rotated.
+   */
+  static void Arc(double speed, double omega, double dt, Pose *pose,
+                  Heading *heading) {
+    double half_turn = 0.5 * omega * dt;
+    double sin_h = std::sin(half_turn);
+    double cos_h = std::cos(half_turn);
+    double sinc = std::fabs(half_turn) > 0 ? sin_h / half_turn : 1.0;
+    double chord = speed * dt * sinc;
+    Heading mid = heading->Rotated(Heading(half_turn, cos_h, sin_h));
+    pose->x += chord * mid.dx;
+    pose->y += chord * mid.dy;
+    *heading = mid.Rotated(Heading(half_turn, cos_h, sin_h));
+    pose->theta += rad2deg(2 * half_turn);
+  }
+};
+
+/**
+ * @brief The differential drive model the simulation has always used (see
+ * MotionBehaviorDifferential): rotation about the ICC, with an axle of 0.5.
+ *
+ * Advance() is DifferentialDriveStep(), the per-slot kernel of
+ * DifferentialIntegrator, which moves every robot and light in the arena;
+ * the two give the same bits. Like the original, the turn (in radians) is
+ * added to the heading in degrees.
+ */
+class DifferentialDriveModel : public MotionModel<DifferentialDriveModel> {
+ public:
+  void Advance(double dt, const WheelVelocity &vel, Pose *pose,
+               Heading *heading) const {
+    DifferentialDriveStep(vel.left, vel.right, dt, &pose->x, &pose->y,
+                          &pose->theta, &heading->dx, &heading->dy);
+    heading->radians = deg2rad(pose->theta);
+  }
+};
+
+/**
+ * @brief Unicycle: forward speed is the mean of the wheels and the turn rate
+ * is their difference over the track, in consistent units, integrated along
+ * the exact arc.
+ */
+class UnicycleModel : public MotionModel<UnicycleModel> {
+ public:
+  explicit UnicycleModel(double in_track = 0.5) : track(in_track) {}
+
+  void Advance(double dt, const WheelVelocity &vel, Pose *pose,
+               Heading *heading) const {
+    Arc(0.5 * (vel.left + vel.right), (vel.left - vel.right) / track, dt,
+        pose, heading);
+  }
+
+  // distance between the wheels
+  double track;
+};
+
+/**
+ * @brief Car-like steering: `vel.left` is the speed and `vel.right` the
+ * steering angle in degrees. The turn rate is speed * tan(steer) / wheelbase.
+ */
+class AckermannModel : public MotionModel<AckermannModel> {
+ public:
+  explicit AckermannModel(double in_wheelbase = 20.0)
+    : wheelbase(in_wheelbase) {}
+
+  void Advance(double dt, const WheelVelocity &vel, Pose *pose,
+               Heading *heading) const {
+    Arc(vel.left, vel.left * std::tan(deg2rad(vel.right)) / wheelbase, dt,
+        pose, heading);
+  }
+
+  // distance between the front and rear axles
+  double wheelbase;
+};
+
+/**
+ * @brief Holonomic base: `vel.left` is the speed along the heading and
+ * `vel.right` the speed to its right. The heading never changes.
+ */
+class HolonomicModel : public MotionModel<HolonomicModel> {
+ public:
+  void Advance(double dt, const WheelVelocity &vel, Pose *pose,
+               Heading *heading) const {
+    pose->x += (vel.left * heading->dx - vel.right * heading->dy) * dt;
+    pose->y += (vel.left * heading->dy + vel.right * heading->dx) * dt;
+  }
+};
+
+/**
+ * @brief A motion behavior whose model is fixed at compile time.
+ *
+ * It has the same UpdatePose(dt, vel) as MotionBehavior, but the call is not
+ * virtual, so an entity holding one by value gets its update inlined.
+ */
+template <class Model>
+class StaticMotionBehavior {
+ public:
+  explicit StaticMotionBehavior(ArenaMobileEntity *ent,
+                                const Model &model = Model())
+    : entity_(ent), model_(model) {}
+
+  /**
+   * @brief Update the pose of the entity by `dt` ticks at velocity `vel`.
+   */
+  void UpdatePose(double dt, WheelVelocity vel) {
+    model_.UpdatePose(entity_, dt, vel);
+  }
+
+  /**
+   * @brief The model, for tuning its parameters.
+   */
+  Model &get_model() { return model_; }
+
+  /**
+   * @brief Getter of entity in which this class was created.
+   */
+  ArenaMobileEntity *get_entity() { return entity_; }
+
+ private:
+  ArenaMobileEntity *entity_;
+  Model model_;
+};
+
+/**
+ * @brief A MotionBehavior running a model, for code that picks the model at
+ * run time through the virtual MotionBehavior interface.
+ */
+template <class Model>
+class DynamicMotionBehavior : public MotionBehavior {
+ public:
+  explicit DynamicMotionBehavior(ArenaMobileEntity *ent,
+                                 const Model &model = Model())
+    : MotionBehavior(ent), model_(model) {}
+
+  void UpdatePose(double dt, WheelVelocity vel) override {
+    model_.UpdatePose(entity_, dt, vel);
+  }
+
+ private:
+  Model model_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_MOTION_MODEL_H_
@@ -0,0 +1,26 @@
+/**
+ * @file neural_behavior.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/neural_behavior.h"
+#include "src/params.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+NeuralBehavior::NeuralBehavior() {
+  // ensure that the class reflects the correct behavior
+  behv_ = kNeural;
+}
+
+NAMESPACE_END(csci3081);
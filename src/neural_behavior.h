@@ -0,0 +1,48 @@
+/**
+ * @file neural_behavior.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_NEURAL_BEHAVIOR_H_
+#define SRC_NEURAL_BEHAVIOR_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/common.h"
+#include "src/memory_accounting.h"
+#include "src/robot_behavior.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Class representing the neural network behavior of a robot.
+ *
+ * A RobotBehavior that the Robot gives its profile's NeuralNetwork, loaded
+ * from a weights file (see LoadNeuralNetwork()).
+ */
+class NeuralBehavior : public RobotBehavior,
+                       private Accounted<NeuralBehavior, kAccountBehavior> {
+ public:
+  /**
+   * @brief Constructor for initializing the behavior.
+   */
+  NeuralBehavior();
+
+ /**
+  * @brief Command that returns the behavior type for the class.
+  * @param[out] behv_ The enum type of the behavior
+  */
+  RobotBehaviorEnum get_behv() { return behv_; }
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_NEURAL_BEHAVIOR_H_
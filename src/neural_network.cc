@@ -0,0 +1,78 @@
+/**
+ * @file neural_network.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <fstream>
+#include <sstream>
+
+#include "src/neural_network.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+WheelVelocity NeuralNetwork::Apply(double light_left, double light_right,
+                                   double food_left, double food_right,
+                                   bool hungry, double max_sens) const {
+  const double in[kBehaviorInputs] = {
+    hungry ? food_left : 0, hungry ? food_right : 0, max_sens, light_left,
+    light_right};
+  double act[kMaxHiddenUnits];
+  for (size_t h = 0; h < hidden; ++h) {
+    const double *w = hidden_row(h);
+    double sum = w[kBehaviorInputs];
+    for (int k = 0; k < kBehaviorInputs; ++k) sum += w[k] * in[k];
+    act[h] = Softsign(sum);
+  }
+  double out[2];
+  for (int wheel = 0; wheel < 2; ++wheel) {
+    const double *w = output_row(wheel);
+    double sum = w[hidden];
+    for (size_t h = 0; h < hidden; ++h) sum += w[h] * act[h];
+    out[wheel] = sum;
+  }
+  return WheelVelocity(out[0], out[1]);
+}
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+bool LoadNeuralNetwork(const std::string &path, NeuralNetwork *net) {
+  std::ifstream in(path);
+  if (!in) return false;
+  std::vector<double> numbers;
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line.substr(0, line.find('#')));
+    double value = 0;
+    while (fields >> value) numbers.push_back(value);
+    if (!fields.eof()) return false;
+  }
+
+  if (numbers.empty() || numbers[0] < 0 || numbers[0] > kMaxHiddenUnits ||
+      std::fabs(numbers[0] - std::round(numbers[0])) > 0) {
+    return false;
+  }
+  NeuralNetwork parsed;
+  parsed.hidden = static_cast<size_t>(numbers[0]);
+  size_t n_hidden = parsed.hidden * (kBehaviorInputs + 1);
+  size_t n_output = 2 * (parsed.hidden + 1);
+  if (numbers.size() != 1 + n_hidden + n_output) return false;
+  parsed.hidden_weights.assign(numbers.begin() + 1,
+                               numbers.begin() + 1 + n_hidden);
+  parsed.output_weights.assign(numbers.begin() + 1 + n_hidden,
+                               numbers.end());
+  *net = parsed;
+  return true;
+}
+
+NAMESPACE_END(csci3081);
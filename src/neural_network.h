@@ -0,0 +1,101 @@
+/**
+ * @file neural_network.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_NEURAL_NETWORK_H_
+#define SRC_NEURAL_NETWORK_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "src/behavior_matrix.h"
+#include "src/common.h"
+#include "src/wheel_velocity.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+// The widest hidden layer a NeuralNetwork may have, so BehaviorBatch can
+// keep a block of hidden activations on the stack
+constexpr size_t kMaxHiddenUnits = 64;
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief A small learned controller: the BehaviorMatrix inputs, one hidden
+ * layer, and the two wheel speeds out.
+ *
+ * Each hidden unit is a weighted sum of the inputs plus a bias, passed
+ * through softsign, x / (1 + |x|), which needs no library call and so
+ * vectorises where tanh would not. Each wheel speed is a weighted sum of
+ * the hidden units plus a bias. Sums start from the bias and add terms in
+ * order, the order BehaviorBatch uses too, so both give the same bits.
+ *
+ * An empty network (no hidden units, zero biases) leaves its robots still.
+ */
+struct NeuralNetwork {
+  size_t hidden{0};
+  // per hidden unit, one weight per BehaviorInput and then the bias
+  std::vector<double> hidden_weights{};
+  // per wheel (left, right), one weight per hidden unit and then the bias
+  std::vector<double> output_weights = std::vector<double>(2);
+
+  /**
+   * @brief The weights and bias of hidden unit `h`.
+   */
+  const double *hidden_row(size_t h) const {
+    return &hidden_weights[h * (kBehaviorInputs + 1)];
+  }
+
+  /**
+   * @brief The weights and bias of wheel `wheel` (0 left, 1 right).
+   */
+  const double *output_row(int wheel) const {
+    return &output_weights[wheel * (hidden + 1)];
+  }
+
+  /**
+   * @brief The wheel speeds for one set of readings, before clamping.
+   */
+  WheelVelocity Apply(double light_left, double light_right,
+                      double food_left, double food_right, bool hungry,
+                      double max_sens) const;
+};
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief The hidden layer's activation.
+ */
+inline double Softsign(double x) { return x / (1 + std::fabs(x)); }
+
+/**
+ * @brief Load a NeuralNetwork from a weights file.
+ *
+ * The file is a list of numbers separated by white space; anything after a
+ * `#` on a line is ignored. The first number is the hidden unit count, at
+ * most kMaxHiddenUnits. Then come, for each hidden unit, its five weights
+ * (in BehaviorInput order) and bias, and then, for the left and then the
+ * right wheel, one weight per hidden unit and the bias.
+ *
+ * @return false, leaving `net` alone, if the file cannot be read or does
+ * not hold exactly that many numbers.
+ */
+bool LoadNeuralNetwork(const std::string &path, NeuralNetwork *net);
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_NEURAL_NETWORK_H_
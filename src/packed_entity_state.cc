@@ -0,0 +1,135 @@
+/**
+ * @file packed_entity_state.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cmath>
+
+#include "src/packed_entity_state.h"
+#include "src/params.h"
+#include "src/robot.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Static Data
+ ******************************************************************************/
+static const RgbColor kPalette[] = {
+  DEFAULT_COLOR, ROBOT_COLOR, FEAR_COLOR, AGGRESSIVE_COLOR, EXPLORE_COLOR,
+  LOVE_COLOR, FOOD_COLOR, OBSTACLE_COLOR,
+  {192, 192, 192},  // sensor grey
+  {255, 0, 0}, {0, 255, 0}, {0, 0, 255}, {255, 255, 50}, {255, 130, 0},
+  {75, 0, 150}, {0, 0, 0}
+};
+
+static const size_t kPaletteSize = sizeof(kPalette) / sizeof(kPalette[0]);
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+// Timers are stored as whole ticks; anything at or below zero has expired.
+static uint16_t ToTicks(double timer) {
+  if (!(timer > 0)) return 0;
+  if (timer > UINT16_MAX) return UINT16_MAX;
+  return static_cast<uint16_t>(std::lround(timer));
+}
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+ColorPalette::ColorPalette() : colors_(kPalette, kPalette + kPaletteSize) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+RgbColor ColorPalette::ColorAt(uint8_t index) const {
+  return index < colors_.size() ? colors_[index] : colors_[0];
+}
+
+uint8_t ColorPalette::IndexOf(const RgbColor &color) {
+  size_t best = 0;
+  int best_dist = -1;
+  for (size_t i = 0; i < colors_.size(); i++) {
+    int dr = colors_[i].r - color.r;
+    int dg = colors_[i].g - color.g;
+    int db = colors_[i].b - color.b;
+    int dist = dr * dr + dg * dg + db * db;
+    if (dist == 0) return static_cast<uint8_t>(i);
+    if (best_dist < 0 || dist < best_dist) {
+      best = i;
+      best_dist = dist;
+    }
+  }
+  // a palette miss: remember the colour, so unpacking gives it back
+  if (colors_.size() < kMaxColors) {
+    colors_.push_back(color);
+    return static_cast<uint8_t>(colors_.size() - 1);
+  }
+  return static_cast<uint8_t>(best);
+}
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+PackedEntityState PackEntity(const ArenaEntity &ent, ColorPalette *palette) {
+  PackedEntityState state;
+  state.x = static_cast<float>(ent.get_pose().x);
+  state.y = static_cast<float>(ent.get_pose().y);
+  state.theta = static_cast<float>(ent.get_pose().theta);
+  state.radius = static_cast<float>(ent.get_radius());
+  state.id = ent.get_id();
+  state.type = static_cast<uint8_t>(ent.get_type());
+  state.color_index = palette->IndexOf(ent.get_color());
+  state.set_flag(kPackedMobile, ent.get_type() == kRobot ||
+                                ent.get_type() == kLight);
+  return state;
+}
+
+PackedEntityState PackRobot(const Robot &robot, ColorPalette *palette) {
+  PackedEntityState state = PackEntity(robot, palette);
+  state.behavior = static_cast<uint8_t>(robot.get_behavior_enum());
+  state.hungry_ticks = ToTicks(robot.get_hungry());
+  state.starving_ticks = ToTicks(robot.get_starving());
+  state.death_ticks = ToTicks(robot.get_death_timer());
+  state.arc_ticks = ToTicks(robot.get_arc_ticks());
+  state.set_flag(kPackedCollided, robot.get_collision_cond());
+  state.set_flag(kPackedHungry, robot.get_is_hungry());
+  state.set_flag(kPackedStarving, robot.get_is_starving());
+  state.set_flag(kPackedDead, robot.get_dead());
+  state.set_flag(kPackedFoodFlag, robot.get_food_flag());
+  return state;
+}
+
+void UnpackEntity(const PackedEntityState &state,
+                  const ColorPalette &palette, ArenaEntity *ent) {
+  ent->set_pose(state.get_pose());
+  ent->set_radius(state.get_radius());
+  ent->set_id(state.id);
+  ent->set_type(state.get_type());
+  ent->set_color(state.get_color(palette));
+}
+
+void UnpackRobot(const PackedEntityState &state, const ColorPalette &palette,
+                 Robot *robot) {
+  UnpackEntity(state, palette, robot);
+  if (robot->get_behavior_enum() != state.get_behavior_enum()) {
+    robot->set_behavior_enum(state.get_behavior_enum());
+    robot->set_behavior_handler();
+  }
+  robot->set_hunger_state(state.hungry_ticks, state.starving_ticks,
+                          state.death_ticks, state.has_flag(kPackedHungry),
+                          state.has_flag(kPackedStarving));
+  robot->set_collision_cond(state.has_flag(kPackedCollided));
+  robot->set_arc_ticks(state.arc_ticks);
+  robot->set_dead(state.has_flag(kPackedDead));
+  robot->set_food_flag(state.has_flag(kPackedFoodFlag));
+}
+
+NAMESPACE_END(csci3081);
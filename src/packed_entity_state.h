@@ -0,0 +1,189 @@
+/**
+ * @file packed_entity_state.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_PACKED_ENTITY_STATE_H_
+#define SRC_PACKED_ENTITY_STATE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <vector>
+
+#include "src/arena_entity.h"
+#include "src/common.h"
+#include "src/entity_type.h"
+#include "src/pose.h"
+#include "src/rgb_color.h"
+#include "src/robot_behavior.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+class Robot;
+
+/**
+ * @brief Bits of PackedEntityState::flags.
+ */
+enum PackedFlag {
+  kPackedMobile = 1 << 0,
+  kPackedCollided = 1 << 1,
+  kPackedHungry = 1 << 2,
+  kPackedStarving = 1 << 3,
+  kPackedDead = 1 << 4,
+  kPackedFoodFlag = 1 << 5
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief The colours of a snapshot, so each entity's colour is a single
+ * byte index.
+ *
+ * A palette starts with every colour in params.h plus the RgbColorEnum
+ * colours. A colour outside those is added the first time it is packed,
+ * so colours configured at run time round-trip exactly; the palette is
+ * kept with the snapshot it was packed with. Only once it holds
+ * kMaxColors colours does a new colour map to the nearest entry.
+ */
+class ColorPalette {
+ public:
+  static const size_t kMaxColors = 256;
+
+  ColorPalette();
+
+  /**
+   * @brief Number of colours in the palette.
+   */
+  size_t size() const { return colors_.size(); }
+
+  /**
+   * @brief The colour stored at a palette index.
+   *
+   * @param index A value returned by IndexOf(). Out of range indices map to
+   * the first entry.
+   */
+  RgbColor ColorAt(uint8_t index) const;
+
+  /**
+   * @brief The palette index of a colour, adding the colour if it is not
+   * in the palette yet.
+   */
+  uint8_t IndexOf(const RgbColor &color);
+
+ private:
+  std::vector<RgbColor> colors_;
+};
+
+/**
+ * @brief A compact, 32 byte snapshot of the per-entity simulation state.
+ *
+ * This is a serialization format, for saving, sending or comparing arena
+ * state. It does not shrink the simulation's working set: the live
+ * entities keep their double precision poses, RgbColor colours and double
+ * hunger timers, and the tick loop steps those rather than this struct.
+ * Stepping packed state directly would need float physics, which would
+ * change results, so it is left out. Pose and radius are single precision,
+ * the colour is an index into the ColorPalette packed alongside, booleans
+ * are bits of `flags`, and the robot hunger timers are tick counts. The
+ * accessors mirror the ArenaEntity/Robot getters so code reading a
+ * snapshot looks like code reading the entity.
+ */
+struct PackedEntityState {
+ public:
+  float x{0};
+  float y{0};
+  float theta{0};
+  float radius{0};
+  int32_t id{-1};
+  uint16_t hungry_ticks{0};
+  uint16_t starving_ticks{0};
+  uint16_t death_ticks{0};
+  uint16_t arc_ticks{0};
+  uint8_t type{kEntity};
+  uint8_t color_index{0};
+  uint8_t behavior{kNothing};
+  uint8_t flags{0};
+
+  /**
+   * @brief The pose in double precision.
+   */
+  Pose get_pose() const { return Pose(x, y, theta); }
+
+  /**
+   * @brief The radius in double precision.
+   */
+  double get_radius() const { return radius; }
+
+  /**
+   * @brief The colour looked up in the palette it was packed with.
+   */
+  RgbColor get_color(const ColorPalette &palette) const {
+    return palette.ColorAt(color_index);
+  }
+
+  /**
+   * @brief The entity type.
+   */
+  EntityType get_type() const { return static_cast<EntityType>(type); }
+
+  /**
+   * @brief The robot behavior (kNothing for other entities).
+   */
+  RobotBehaviorEnum get_behavior_enum() const {
+    return static_cast<RobotBehaviorEnum>(behavior);
+  }
+
+  /**
+   * @brief Whether a flag from PackedFlag is set.
+   */
+  bool has_flag(PackedFlag flag) const { return (flags & flag) != 0; }
+
+  /**
+   * @brief Set or clear a flag from PackedFlag.
+   */
+  void set_flag(PackedFlag flag, bool value) {
+    flags = static_cast<uint8_t>(value ? (flags | flag) : (flags & ~flag));
+  }
+};
+
+static_assert(sizeof(PackedEntityState) == 32,
+              "PackedEntityState must stay 32 bytes");
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief Pack the state shared by all entities, adding its colour to
+ * `palette` if needed.
+ */
+PackedEntityState PackEntity(const ArenaEntity &ent, ColorPalette *palette);
+
+/**
+ * @brief Pack a robot, including its behavior, hunger timers and flags.
+ */
+PackedEntityState PackRobot(const Robot &robot, ColorPalette *palette);
+
+/**
+ * @brief Write the state shared by all entities back into an entity.
+ *
+ * @param palette The palette `state` was packed with.
+ */
+void UnpackEntity(const PackedEntityState &state,
+                  const ColorPalette &palette, ArenaEntity *ent);
+
+/**
+ * @brief Write a packed robot back into a robot.
+ */
+void UnpackRobot(const PackedEntityState &state, const ColorPalette &palette,
+                 Robot *robot);
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_PACKED_ENTITY_STATE_H_
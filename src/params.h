@@ -34,7 +34,42 @@
 #define MAX_NUM_LIGHTS 7
 #define ARENA_X_DIM X_DIM
 #define ARENA_Y_DIM Y_DIM
-#define PI 3.1459
+
+// simulated seconds per physics tick
+#define TICK_TIME 0.05
+// most ticks a single Arena::AdvanceTime call will run
+#define MAX_SUBSTEPS 1000
+// wall clock seconds the viewer may spend stepping per rendered frame
+#define FRAME_BUDGET 0.012
+
+// threads updating entities in parallel (0 = one per hardware thread)
+#define N_THREADS 0
+// fewest entities worth handing to one thread
+#define PARALLEL_MIN_CHUNK 256
+
+// skip contact checks until an entity's earliest possible contact (0 = check
+// every entity every tick)
+#define EVENT_DRIVEN 1
+
+// let each step cover several ticks when the robots' wheel velocities are
+// changing slowly (0 = one tick per step)
+#define ADAPTIVE_STEP 0
+// position error, in arena units, an adaptive step may introduce
+#define STEP_TOLERANCE 0.25
+// most ticks one adaptive step may cover
+#define MAX_STEP_TICKS 16
+
+// place cruising lights from their straight line path instead of
+// integrating them every tick (0 = integrate every light). Off by default:
+// the closed form rounds differently, so results are not the same bits
+#define BALLISTIC_LIGHTS 0
+
+// move robots and lights and resolve contacts in Q16.16 fixed point, for
+// results that are the same bits on every platform (0 = double)
+#define FIXED_POINT 0
+
+// seed for entity placement (0 = seed from the current time)
+#define ARENA_SEED 0
 
 // game status
 #define WON 0
@@ -51,7 +86,10 @@
 
 // mobile entity
 #define STARTING_VELOCITY 0.0
+// length of the reverse arc after a collision, in simulated seconds, and
+// the same in whole ticks (2 at the default TICK_TIME)
 #define ARC_TIME 0.1
+#define ARC_TICKS (static_cast<int>(ARC_TIME / TICK_TIME + 0.5))
 
 // robot
 #define ROBOT_ANGLE_DELTA 1
@@ -76,12 +114,14 @@
 #define ROBOT_AGGRESSIVE 0
 #define ROBOT_EXPLORE 5
 #define ROBOT_LOVE 0
+#define ROBOT_NEURAL 0
 #define MAX_ROBOT 10
 
 #define AGGRESSIVE_COLOR {216, 8, 8}
 #define FEAR_COLOR {130, 162, 242}
 #define EXPLORE_COLOR {255, 144, 0}
 #define LOVE_COLOR {252, 121, 234}
+#define NEURAL_COLOR {64, 200, 120}
 
 // food
 #define FOOD_RADIUS 20
@@ -99,6 +139,10 @@
 #define OBSTACLE_MAX_RADIUS 50
 #define OBSTACLE_COLOR \
   { 255, 255, 255 }
+// wheel speed of a light outside its reverse arc
+#define LIGHT_SPEED 3.0
+// wheel speed of a light during its reverse arc
+#define LIGHT_ARC_SPEED 5.0
 
 // sensor
 #define MAX_SENS 20.0
@@ -10,6 +10,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cmath>
+
 #include "src/common.h"
 
 /*******************************************************************************
@@ -75,6 +77,55 @@ struct Pose {
 constexpr double deg2rad(double deg) { return deg * M_PI / 180.0; }
 constexpr double rad2deg(double rad) { return rad * 180.0 / M_PI; }
 
+/**
+ * @brief A heading in radians together with its unit vector.
+ *
+ * Pose keeps the heading in degrees for the GUI and the public API. Motion
+ * and sensor code works from a Heading instead, so the direction an entity
+ * faces is available without converting units or calling sin and cos.
+ */
+struct Heading {
+ public:
+  /**
+   * @brief Default constructor. Faces along +x.
+   */
+  Heading() {}
+
+  /**
+   * @brief Constructor from an angle and its already known unit vector.
+   *
+   * @param in_radians The angle in radians.
+   * @param in_dx cos(in_radians).
+   * @param in_dy sin(in_radians).
+   */
+  Heading(double in_radians, double in_dx, double in_dy)
+    : radians(in_radians),
+      dx(in_dx),
+      dy(in_dy) {}
+
+  /**
+   * @brief The heading for an angle in degrees.
+   */
+  static Heading FromDegrees(double degrees) {
+    double rad = deg2rad(degrees);
+    return Heading(rad, std::cos(rad), std::sin(rad));
+  }
+
+  /**
+   * @brief This heading turned further by `other`, by rotating the unit
+   * vector rather than evaluating sin and cos again.
+   */
+  Heading Rotated(const Heading &other) const {
+    return Heading(radians + other.radians,
+                   dx * other.dx - dy * other.dy,
+                   dy * other.dx + dx * other.dy);
+  }
+
+  double radians{0.0};
+  double dx{1.0};
+  double dy{0.0};
+};
+
 NAMESPACE_END(csci3081);
 
 #endif  // SRC_POSE_H_
@@ -7,6 +7,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <algorithm>
+
 #include "src/robot.h"
 #include "src/params.h"
 
@@ -19,116 +21,165 @@ NAMESPACE_BEGIN(csci3081);
  * Constructors/Destructor
  ******************************************************************************/
 Robot::Robot() :
-  motion_handler_(new MotionHandlerRobot(this)),
+  Accounted(),
+  hot_(),
+  left_light_sensor_(this, -40.0),
+  right_light_sensor_(this, +40.0),
+  left_food_sensor_(this, -40.0),
+  right_food_sensor_(this, +40.0),
+  motion_handler_(this),
+  motion_behavior_(this),
+  profiles_(&RobotProfileTable::Default()),
+  behv_type_(kNothing) {
+  set_type(kRobot);
+  set_color(get_profile().color);
+  // a robot on its own is not placed at random; the EntityFactory places
+  // robots in an arena
+  set_pose(ROBOT_INIT_POS);
+  set_radius(get_profile().min_radius);
+  ApplyProfile();
+  ResetHunger();
+}
+
+Robot::Robot(RobotBehaviorEnum behv, const Pose &pose, double radius,
+             const RobotProfileTable *profiles) :
+  Accounted(),
+  hot_(),
+  left_light_sensor_(this, -40.0),
+  right_light_sensor_(this, +40.0),
+  left_food_sensor_(this, -40.0),
+  right_food_sensor_(this, +40.0),
+  motion_handler_(this),
   motion_behavior_(this),
-  behv_type_(kNothing),
-  left_light_sensor_(new LightSensor(this, -40.0)),
-  right_light_sensor_(new LightSensor(this, +40.0)),
-  left_food_sensor_(new FoodSensor(this, -40.0)),
-  right_food_sensor_(new FoodSensor(this, +40.0)),
-  hungry_(ROBOT_HUNGER),
-  is_hungry_(false),
-  starving_(ROBOT_STARVE),
-  is_starving_(false),
-  death_timer_(ROBOT_DEATH),
-  dead_(false),
-  collision_timer_(0),
-  collision_cond_(false),
-  food_flag_(true) {
+  profiles_(profiles),
+  behv_type_(behv) {
   set_type(kRobot);
-  set_color(ROBOT_COLOR);
-  set_pose(SetPoseRandomlyAux());
-  set_radius(random() % (ROBOT_MAX_RADIUS -
-    ROBOT_MIN_RADIUS + 1) + ROBOT_MIN_RADIUS);
+  set_color(get_profile().color);
+  set_pose(pose);
+  set_radius(radius);
+  ApplyProfile();
+  if (behv != kNothing)
+    set_behavior_handler();
+  ResetHunger();
 }
+
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 void Robot::TimestepUpdate(unsigned int dt) {
+  PrepareStep(dt);
+
+  // Update robot position
+  motion_behavior_.UpdatePose(dt, motion_handler_.get_velocity());
+
+  FinishStep();
+}
+
+void Robot::PrepareStep(unsigned int dt) {
+  BeginStep(dt);
+
+  // update the velocity of the robot
+  motion_handler_.UpdateVelocity(left_light_sensor_.get_reading(),
+    right_light_sensor_.get_reading(), left_food_sensor_.get_reading(),
+    right_food_sensor_.get_reading(), hot_.is_hungry, hot_.is_starving);
+}
+
+void Robot::BeginStep(unsigned int dt) {
   // update sensor positions
-  left_light_sensor_->Update_Pose();
-  right_light_sensor_->Update_Pose();
-  left_food_sensor_->Update_Pose();
-  right_food_sensor_->Update_Pose();
+  left_light_sensor_.Update_Pose();
+  right_light_sensor_.Update_Pose();
+  left_food_sensor_.Update_Pose();
+  right_food_sensor_.Update_Pose();
 
-  UpdateHunger();
+  UpdateHunger(dt);
 
   // check if the robot has collided with something
-  if (collision_cond_) {
+  if (hot_.collision_cond) {
     WheelVelocity vel_a(7.0, 7.0);
-    double secondsPassed = (clock() - collision_timer_) / CLOCKS_PER_SEC;
-    if (secondsPassed < ARC_TIME) {
-      motion_handler_->UpdateVelocity(vel_a);  // change velocity
+    if (hot_.arc_ticks > 0) {
+      motion_handler_.UpdateVelocity(vel_a);  // change velocity
       RelativeChangeHeading(4);
+      hot_.arc_ticks -= std::min(dt, hot_.arc_ticks);
     } else {
-      collision_cond_ = false;  // reset the flag
+      hot_.collision_cond = false;  // reset the flag
     }
   }
+}
 
-  // update the velocity of the robot
-  motion_handler_->UpdateVelocity(left_light_sensor_->get_reading(),
-    right_light_sensor_->get_reading(), left_food_sensor_->get_reading(),
-    right_food_sensor_->get_reading(), is_hungry_, is_starving_);
-
-  // Update robot position
-  motion_behavior_.UpdatePose(dt, motion_handler_->get_velocity());
-
+void Robot::FinishStep() {
   // Reset Sensors for next cycle
-  left_light_sensor_->Reset();
-  right_light_sensor_->Reset();
-  left_food_sensor_->Reset();
-  right_food_sensor_->Reset();
+  left_light_sensor_.Reset();
+  right_light_sensor_.Reset();
+  left_food_sensor_.Reset();
+  right_food_sensor_.Reset();
   sensor_touch_->Reset();
 }
 
+void Robot::set_behavior_handler() {
+  motion_handler_.CreateBehavior(behv_type_);
+  motion_handler_.get_behavior()->set_max_sens(get_profile().max_sens);
+  motion_handler_.get_behavior()->set_matrix(&get_profile().matrix);
+  if (behv_type_ == kNeural)
+    motion_handler_.get_behavior()->set_network(&get_profile().network);
+}
+
+void Robot::ApplyProfile() {
+  const RobotProfile &prof = get_profile();
+  motion_handler_.set_max_speed(prof.max_speed);
+  motion_handler_.set_max_angle(prof.max_angle);
+  left_light_sensor_.set_numerator(prof.light_numerator);
+  right_light_sensor_.set_numerator(prof.light_numerator);
+  left_food_sensor_.set_numerator(prof.food_numerator);
+  right_food_sensor_.set_numerator(prof.food_numerator);
+}
+
 void Robot::ResetHunger() {
-  hungry_ = ROBOT_HUNGER;
-  is_hungry_ = false;
-  starving_ = ROBOT_STARVE,
-  is_starving_ = false,
-  death_timer_ = ROBOT_DEATH;
+  const RobotProfile &prof = get_profile();
+  hot_.hungry = prof.hunger;
+  hot_.is_hungry = false;
+  hot_.starving = prof.starve;
+  hot_.is_starving = false;
+  hot_.death_timer = prof.death;
 }
 
-void Robot::UpdateHunger() {
-  if (food_flag_) {
+void Robot::UpdateHunger(unsigned int dt) {
+  if (hot_.food_flag) {
     // ensure robot's death status
-    if (!dead_) {
-      death_timer_--;  // decrement the timer
-      if (death_timer_ <= 0)
-        dead_ = true;
+    if (!hot_.dead) {
+      hot_.death_timer -= dt;  // decrement the timer
+      if (hot_.death_timer <= 0)
+        hot_.dead = true;
     }
 
     // change the flag if the roobt is starving
-    if (!is_starving_) {
-      starving_--;  // decrement the timer
-      if (starving_ <= 0)
-        is_starving_ = true;
+    if (!hot_.is_starving) {
+      hot_.starving -= dt;  // decrement the timer
+      if (hot_.starving <= 0)
+        hot_.is_starving = true;
     }
 
     // change the flag if the robot is hungry
-    if (!is_hungry_) {
-      hungry_--;  // decrement the timer
-      if (hungry_ <= 0)
-        is_hungry_ = true;
+    if (!hot_.is_hungry) {
+      hot_.hungry -= dt;  // decrement the timer
+      if (hot_.hungry <= 0)
+        hot_.is_hungry = true;
     }
   }  // end outer most it
 }
 
 void Robot::Reset() {
-  motion_handler_->set_velocity(0.0, 0.0);
-  set_pose(SetPoseRandomlyAux());
-  set_radius(random() % (ROBOT_MAX_RADIUS -
-    ROBOT_MIN_RADIUS + 1) + ROBOT_MIN_RADIUS);
-  motion_handler_->set_max_speed(ROBOT_MAX_SPEED);
-  motion_handler_->set_max_angle(ROBOT_MAX_ANGLE);
+  motion_handler_.set_velocity(0.0, 0.0);
+  motion_handler_.set_max_speed(get_profile().max_speed);
+  motion_handler_.set_max_angle(get_profile().max_angle);
   sensor_touch_->Reset();
-  left_light_sensor_->Reset();
-  right_light_sensor_->Reset();
-  left_food_sensor_->Reset();
-  right_food_sensor_->Reset();
+  left_light_sensor_.Reset();
+  right_light_sensor_.Reset();
+  left_food_sensor_.Reset();
+  right_food_sensor_.Reset();
   ResetHunger();
-  dead_ = false;
-  collision_cond_ = false;
+  hot_.dead = false;
+  hot_.collision_cond = false;
+  hot_.arc_ticks = 0;
 }
 
 void Robot::HandleCollision(EntityType object_type, ArenaEntity * object) {
@@ -136,17 +187,15 @@ void Robot::HandleCollision(EntityType object_type, ArenaEntity * object) {
 }
 
 void Robot::UpdateColor(RobotBehaviorEnum behv) {
-  switch (behv) {
-    case kFear: set_color(FEAR_COLOR);
-      break;
-    case kAggressive: set_color(AGGRESSIVE_COLOR);
-      break;
-    case kLove: set_color(LOVE_COLOR);
-      break;
-    case kExplore: set_color(EXPLORE_COLOR);
-      break;
-    default: set_color(ROBOT_COLOR);
-  }
+  set_color(profiles_->get(behv).color);
+}
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+size_t AccountedSize<Robot>::bytes() {
+  return sizeof(Robot) - 2 * sizeof(LightSensor) - 2 * sizeof(FoodSensor) -
+         sizeof(MotionHandlerRobot);
 }
 
 NAMESPACE_END(csci3081);
@@ -15,12 +15,14 @@
 #include "src/arena_mobile_entity.h"
 #include "src/common.h"
 #include "src/motion_handler_robot.h"
-#include "src/motion_behavior_differential.h"
+#include "src/motion_model.h"
 #include "src/entity_type.h"
 #include "src/food.h"
 #include "src/robot_behavior.h"
 #include "src/light_sensor.h"
 #include "src/food_sensor.h"
+#include "src/memory_accounting.h"
+#include "src/robot_state.h"
 
 /*******************************************************************************
  * Namespaces
@@ -30,7 +32,16 @@ NAMESPACE_BEGIN(csci3081);
 class LightSensor;
 class FoodSensor;
 class MotionHandlerRobot;
-class MotionBehaviorDifferential;
+class Robot;
+
+/**
+ * @brief A Robot is accounted without its embedded sensors and motion
+ * handler, which report their own bytes.
+ */
+template <>
+struct AccountedSize<Robot> {
+  static size_t bytes();
+};
 
 /*******************************************************************************
  * Class Definitions
@@ -49,8 +60,15 @@ class MotionBehaviorDifferential;
  * The touch sensor is activated when the robot collides with an object.
  * The heading is modified after a collision to move the robot away from the
  * other object.
+ *
+ * A Robot owns its motion handler (which in turn owns the RobotBehavior) and
+ * its four sensors. They are embedded in the Robot together with its per-tick
+ * RobotHotState; the rarely used per-behavior data (colour, hunger limits,
+ * speed limits) lives in a RobotProfileTable and is looked up by the
+ * behavior enum.
  */
-class Robot : public ArenaMobileEntity {
+class Robot : public ArenaMobileEntity,
+              private Accounted<Robot, kAccountRobot> {
  public:
   /**
    * @brief Constructor using initialization values from params.h.
@@ -58,26 +76,41 @@ class Robot : public ArenaMobileEntity {
 
   Robot();
 
+  /**
+   * @brief Constructor used by EntityFactory. Sets the pose, radius and
+   * behavior once, with no random placement.
+   *
+   * @param behv The behavior of the robot. A RobotBehavior is created unless
+   * this is kNothing.
+   * @param pose The initial pose.
+   * @param radius The radius of the robot.
+   * @param profiles The profile table to configure the robot from. It must
+   * outlive the robot.
+   */
+  Robot(RobotBehaviorEnum behv, const Pose &pose, double radius,
+        const RobotProfileTable *profiles = &RobotProfileTable::Default());
+
   /**
    * @brief Reset the Robot to a newly constructed state (needed for reset
-   * button to work in GUI).
+   * button to work in GUI). The Arena's EntityFactory then places it again.
    */
   void Reset() override;
 
   /**
-   * @brief Default destructor.
+   * @brief Destructor. The sensors and motion handler are members, so they
+   * go away with the robot.
    */
-  ~Robot() = default;
+  ~Robot() override = default;
 
   /**
-   * @brief Default = operator overload.
+   * @brief Robots own their sensors and handler, so they cannot be copied.
    */
-  Robot &operator=(const Robot &other) = default;
+  Robot &operator=(const Robot &other) = delete;
 
   /**
-   * @brief Default copy constructor.
+   * @brief Robots own their sensors and handler, so they cannot be copied.
    */
-  Robot(const Robot &other) = default;
+  Robot(const Robot &other) = delete;
 
   /**
    * @brief Update the Robot's position and velocity after the specified
@@ -87,6 +120,34 @@ class Robot : public ArenaMobileEntity {
    */
   void TimestepUpdate(unsigned int dt) override;
 
+  /**
+   * @brief The part of TimestepUpdate() before the pose is integrated:
+   * sensor poses, hunger, the collision arc and the new wheel velocity.
+   *
+   * PrepareStep(), moving the pose by get_velocity(), then FinishStep() is
+   * the same as TimestepUpdate(); the Arena splits it this way to integrate
+   * every robot's pose in one DifferentialIntegrator pass.
+   */
+  void PrepareStep(unsigned int dt);
+
+  /**
+   * @brief PrepareStep() up to, not including, asking the behavior for the
+   * new wheel velocity. The Arena calls this, works out the velocities of
+   * every robot of a behavior together in a BehaviorBatch, then hands each
+   * robot its velocity through MotionHandlerRobot::UpdateVelocity().
+   */
+  void BeginStep(unsigned int dt);
+
+  /**
+   * @brief The part of TimestepUpdate() after the pose is integrated.
+   */
+  void FinishStep();
+
+  /**
+   * @brief The wheel velocity the next pose update will use.
+   */
+  WheelVelocity get_velocity() const { return motion_handler_.get_velocity(); }
+
   /**
    * @brief Handles the collision by setting the sensor to activated.
    */
@@ -100,17 +161,19 @@ class Robot : public ArenaMobileEntity {
   /**
   * @brief Command that returns the motion_handler.
   */
-  MotionHandlerRobot* get_motion_handler() {return motion_handler_;}
+  MotionHandlerRobot* get_motion_handler() {return &motion_handler_;}
 
   /**
   * @brief Command that returns the motion_behavior.
   */
-  MotionBehaviorDifferential get_motion_behavior() {return motion_behavior_;}
+  StaticMotionBehavior<DifferentialDriveModel> &get_motion_behavior() {
+    return motion_behavior_;
+  }
 
   /**
   * @brief Command that returns the RobotBehaviorEnum.
   */
-  RobotBehaviorEnum get_behavior_enum() { return behv_type_; }
+  RobotBehaviorEnum get_behavior_enum() const { return behv_type_; }
 
   /**
   * @brief Command that sets the RobotBehaviorEnum to the param.
@@ -123,17 +186,50 @@ class Robot : public ArenaMobileEntity {
   * @brief Command that sets sets the RobotBehavior depending on the 
   * behavior type.
   */
-  void set_behavior_handler() { motion_handler_->CreateBehavior(behv_type_); }
+  void set_behavior_handler();
 
   /**
   * @brief Command that returns starvation timer
   */
-  double get_starving() { return starving_; }
+  double get_starving() const { return hot_.starving; }
 
   /**
   * @brief Command that sets the starving timer to a specified value.
   */
-  void set_starving(double num) { starving_ = num; }
+  void set_starving(double num) { hot_.starving = num; }
+
+  /**
+  * @brief Command that returns the hungry timer.
+  */
+  double get_hungry() const { return hot_.hungry; }
+
+  /**
+  * @brief Command that returns the death timer.
+  */
+  double get_death_timer() const { return hot_.death_timer; }
+
+  /**
+  * @brief Command that returns whether the robot is hungry.
+  */
+  bool get_is_hungry() const { return hot_.is_hungry; }
+
+  /**
+  * @brief Command that returns whether the robot is starving.
+  */
+  bool get_is_starving() const { return hot_.is_starving; }
+
+  /**
+  * @brief Command that restores all hunger timers and flags at once (used
+  * when unpacking a PackedEntityState).
+  */
+  void set_hunger_state(double hungry, double starving, double death,
+                        bool is_hungry, bool is_starving) {
+    hot_.hungry = hungry;
+    hot_.starving = starving;
+    hot_.death_timer = death;
+    hot_.is_hungry = is_hungry;
+    hot_.is_starving = is_starving;
+  }
 
   /**
   * @brief Command that resets the Timers for the robot.
@@ -143,63 +239,83 @@ class Robot : public ArenaMobileEntity {
   /**
   * @brief Command that returns the status of the robot.
   */
-  bool get_dead() { return dead_; }
+  bool get_dead() const { return hot_.dead; }
 
   /**
   * @brief Command that sets the robot's status.
   */
-  void set_dead(bool d) { dead_ = d; }
+  void set_dead(bool d) { hot_.dead = d; }
 
   /**
   * @brief Command that returns a pointer to the left light sensor.
   */
-  LightSensor* get_left_light_sensor() const { return left_light_sensor_; }
+  LightSensor* get_left_light_sensor() { return &left_light_sensor_; }
 
   /**
   * @brief Command that returns a pointer to the right light sensor.
   */
-  LightSensor* get_right_light_sensor() const { return right_light_sensor_; }
+  LightSensor* get_right_light_sensor() { return &right_light_sensor_; }
 
   /**
   * @brief Command that returns a pointer to the left food sensor.
   */
-  FoodSensor* get_left_food_sensor() const { return left_food_sensor_; }
+  FoodSensor* get_left_food_sensor() { return &left_food_sensor_; }
 
   /**
   * @brief Command that returns a pointer to the right food sensor.
   */
-  FoodSensor* get_right_food_sensor() const { return right_food_sensor_; }
+  FoodSensor* get_right_food_sensor() { return &right_food_sensor_; }
 
   /**
   * @brief Command that starts a collision timer for the robot.
   */
-  void set_collision_timer() { collision_timer_ = clock(); }
+  void set_collision_timer() { hot_.arc_ticks = get_profile().arc_ticks; }
+
+  /**
+  * @brief Both wheels are clamped to the maximum speed, and neither a
+  * straight move nor an arc covers more than that in one tick.
+  */
+  double get_max_step() const override {
+    return motion_handler_.get_max_speed();
+  }
+
+  /**
+  * @brief Ticks left in the reverse arc after a collision.
+  */
+  unsigned int get_arc_ticks() const { return hot_.arc_ticks; }
+
+  /**
+  * @brief Set the ticks left in the reverse arc.
+  */
+  void set_arc_ticks(unsigned int ticks) { hot_.arc_ticks = ticks; }
 
   /**
   * @brief Command that sets the collision_cond_ depending on the param.
   */
-  void set_collision_cond(bool flag) { collision_cond_ = flag; }
+  void set_collision_cond(bool flag) { hot_.collision_cond = flag; }
 
   /**
   * @brief Command that returns a bool value of the collision_cond_.
   */
-  bool get_collision_cond() { return collision_cond_; }
+  bool get_collision_cond() const { return hot_.collision_cond; }
 
   /**
   * @brief Command that sets the food_flag_ depending on param.
   */
-  void set_food_flag(bool flag) { food_flag_ = flag; }
+  void set_food_flag(bool flag) { hot_.food_flag = flag; }
 
   /**
   * @brief Command that returns a bool value of the food_flag_.
   */
-  bool get_food_flag() { return food_flag_; }
+  bool get_food_flag() const { return hot_.food_flag; }
 
   /**
   * @brief Command that updates the hunger flags depending on the 
   * flag that is set by the arena.
+  *
+  * @param[in] dt ticks elapsed, taken off each running timer.
   */
-  void UpdateHunger();
+  void UpdateHunger(unsigned int dt = 1);
 
   /**
   * @brief Command that updates the color of the robot depending on the 
@@ -207,39 +323,43 @@ class Robot : public ArenaMobileEntity {
   */
   void UpdateColor(RobotBehaviorEnum behv);
 
+  /**
+  * @brief Command that returns the cold configuration of the robot, looked up
+  * in its profile table by behavior.
+  */
+  const RobotProfile &get_profile() const { return profiles_->get(behv_type_); }
+
+  /**
+  * @brief Command that sets the profile table the robot reads its
+  * configuration from. The table must outlive the robot.
+  */
+  void set_profile_table(const RobotProfileTable *profiles) {
+    profiles_ = profiles;
+  }
+
  private:
+  /**
+  * @brief Configure the motion handler and sensors from the profile.
+  */
+  void ApplyProfile();
+
+  // Per-tick state: hunger timers, collision arc and flags.
+  RobotHotState hot_;
+  // The sensors and the motion handler are embedded rather than separately
+  // allocated, so a tick does not have to chase pointers to reach them.
+  LightSensor left_light_sensor_;
+  LightSensor right_light_sensor_;
+  FoodSensor left_food_sensor_;
+  FoodSensor right_food_sensor_;
   // Manages pose and wheel velocities that change with time and collisions.
-  MotionHandlerRobot *motion_handler_;
+  MotionHandlerRobot motion_handler_;
   // Calculates changes in pose based on elapsed time and wheel velocities.
-  MotionBehaviorDifferential motion_behavior_;
-  // Enum that holds the behaviorType
+  // The model is a template argument, so the update is not a virtual call.
+  StaticMotionBehavior<DifferentialDriveModel> motion_behavior_;
+  // Cold data: the table holding this robot's RobotProfile and the enum that
+  // indexes it.
+  const RobotProfileTable *profiles_;
   RobotBehaviorEnum behv_type_;
-  // Pointer to the left light sensor
-  LightSensor *left_light_sensor_;
-  // Pointer to the right light sensor
-  LightSensor *right_light_sensor_;
-  // Pointer to the left food sensor
-  FoodSensor *left_food_sensor_;
-  // Pointer to the right food sensor
-  FoodSensor *right_food_sensor_;
-  // value to hold the hungry timer
-  double hungry_;
-  // bool value to determine whether the robot is hungry
-  bool is_hungry_;
-  // value to hold the starving timer
-  double starving_;
-  // bool value to determine whether the robot is starving
-  bool is_starving_;
-  // value to hold the death timer
-  double death_timer_;
-  // bool value to determine whether the robot is dead
-  bool dead_;
-  // clock value for the collsion
-  clock_t collision_timer_;
-  // determines whether the robot has collided with anything
-  bool collision_cond_;
-  // determines whether the food sensors are active
-  bool food_flag_;
 };
 
 NAMESPACE_END(csci3081);
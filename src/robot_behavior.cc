@@ -20,4 +20,18 @@ NAMESPACE_BEGIN(csci3081);
  ******************************************************************************/
 RobotBehavior::RobotBehavior() {}
 
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+WheelVelocity RobotBehavior::Movement(double light_left, double light_right,
+                                      double food_left, double food_right,
+                                      bool hungry) {
+  if (network_ != nullptr) {
+    return network_->Apply(light_left, light_right, food_left, food_right,
+                           hungry, max_sens_);
+  }
+  return matrix_->Apply(light_left, light_right, food_left, food_right,
+                        hungry, max_sens_);
+}
+
 NAMESPACE_END(csci3081);
@@ -10,7 +10,10 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include "src/behavior_matrix.h"
 #include "src/common.h"
+#include "src/neural_network.h"
+#include "src/params.h"
 #include "src/wheel_velocity.h"
 
 /*******************************************************************************
@@ -19,9 +22,13 @@
 NAMESPACE_BEGIN(csci3081);
 
 enum RobotBehaviorEnum {
-  kAggressive, kExplore, kLove, kFear, kNothing
+  kAggressive, kExplore, kLove, kFear, kNothing, kNeural
 };
 
+// Number of RobotBehaviorEnum values. New behaviors go after kNothing, so
+// the earlier ones keep their values.
+constexpr int kNumRobotBehaviors = kNeural + 1;
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -29,7 +36,9 @@ enum RobotBehaviorEnum {
  * @brief Class representing the behavior of a robot.
  *
  * This class acts as the parent class of the other behavior classes like
- * ExploreBehavior, AggressiveBehavior, LoveBehavior, and FearBehavior.
+ * ExploreBehavior, AggressiveBehavior, LoveBehavior, FearBehavior and
+ * NeuralBehavior. Each of those is accounted (see MemoryAccounting) as
+ * itself, so a behavior is counted with its own size.
  */
 class RobotBehavior {
  public:
@@ -43,9 +52,17 @@ class RobotBehavior {
    */
   virtual ~RobotBehavior() = default;
 
+  /**
+   * @brief Behaviors share their matrix, so copies point at the same one.
+   */
+  RobotBehavior(const RobotBehavior &other) = default;
+  RobotBehavior &operator=(const RobotBehavior &other) = default;
+
   /**
    * @brief Calculate the velocity the robot should be moving at, depending
-   * on several factors.
+   * on several factors: by default, the behavior's network, or if it has
+   * none its matrix, applied to the readings (see set_matrix() and
+   * set_network()).
    *
    * @param light_left The reading from the robots left light sensor.
    * @param light_right The reading from the robots right light sensor.
@@ -54,7 +71,7 @@ class RobotBehavior {
    * @param hungry The bool value that specifies whether the robot is hungry.
    */
   virtual WheelVelocity Movement(double llr, double lrr, double flr,
-                     double frr, bool flag) = 0;
+                     double frr, bool flag);
 
   /**
    * @brief Getter for the robot behavior enum
@@ -63,8 +80,44 @@ class RobotBehavior {
    */
   RobotBehaviorEnum get_behavior_enum() { return behv_; }
 
+  /**
+   * @brief Setter for the wheel bias used by the love and explore behaviors.
+   */
+  void set_max_sens(double max_sens) { max_sens_ = max_sens; }
+
+  /**
+   * @brief Getter for the wheel bias.
+   */
+  double get_max_sens() const { return max_sens_; }
+
+  /**
+   * @brief Use `matrix` for Movement(). It is not copied: robots of one
+   * profile all point at its matrix, which is how BehaviorBatch knows it
+   * can evaluate them together.
+   */
+  void set_matrix(const BehaviorMatrix *matrix) { matrix_ = matrix; }
+
+  /**
+   * @brief The matrix Movement() applies.
+   */
+  const BehaviorMatrix *get_matrix() const { return matrix_; }
+
+  /**
+   * @brief Run `network` in Movement() in place of the matrix, or go back
+   * to the matrix with nullptr. Like the matrix, it is not copied.
+   */
+  void set_network(const NeuralNetwork *network) { network_ = network; }
+
+  /**
+   * @brief The network Movement() runs, or nullptr if it applies the matrix.
+   */
+  const NeuralNetwork *get_network() const { return network_; }
+
  protected:
   RobotBehaviorEnum behv_{kNothing};
+  double max_sens_{MAX_SENS};
+  const BehaviorMatrix *matrix_{&kFearMatrix};
+  const NeuralNetwork *network_{nullptr};
 };
 
 NAMESPACE_END(csci3081);
@@ -0,0 +1,56 @@
+/**
+ * @file robot_state.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/robot_state.h"
+#include "src/params.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+RobotProfileTable::RobotProfileTable() : profiles_() {
+  for (int i = kAggressive; i < kNumRobotBehaviors; i++) {
+    RobotProfile &prof = profiles_[i];
+    prof.behavior = static_cast<RobotBehaviorEnum>(i);
+    prof.hunger = ROBOT_HUNGER;
+    prof.starve = ROBOT_STARVE;
+    prof.death = ROBOT_DEATH;
+    prof.max_speed = ROBOT_MAX_SPEED;
+    prof.max_angle = ROBOT_MAX_ANGLE;
+    prof.max_sens = MAX_SENS;
+    prof.min_radius = ROBOT_MIN_RADIUS;
+    prof.max_radius = ROBOT_MAX_RADIUS;
+    prof.arc_ticks = ARC_TICKS;
+    prof.light_numerator = MAX_NUMERATOR;
+    prof.food_numerator = MAX_NUMERATOR;
+  }
+  profiles_[kAggressive].color = AGGRESSIVE_COLOR;
+  profiles_[kExplore].color = EXPLORE_COLOR;
+  profiles_[kLove].color = LOVE_COLOR;
+  profiles_[kFear].color = FEAR_COLOR;
+  profiles_[kNeural].color = NEURAL_COLOR;
+  profiles_[kNothing].color = ROBOT_COLOR;
+  profiles_[kAggressive].matrix = kAggressiveMatrix;
+  profiles_[kExplore].matrix = kExploreMatrix;
+  profiles_[kLove].matrix = kLoveMatrix;
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+const RobotProfileTable &RobotProfileTable::Default() {
+  static const RobotProfileTable table;
+  return table;
+}
+
+NAMESPACE_END(csci3081);
@@ -0,0 +1,129 @@
+/**
+ * @file robot_state.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_ROBOT_STATE_H_
+#define SRC_ROBOT_STATE_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "src/behavior_matrix.h"
+#include "src/common.h"
+#include "src/neural_network.h"
+#include "src/rgb_color.h"
+#include "src/robot_behavior.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief The part of a Robot's own state that changes every tick.
+ *
+ * Hunger timers and the collision arc state are grouped together (and placed
+ * next to the embedded sensors and motion handler in Robot) so that
+ * Robot::TimestepUpdate works on one contiguous block instead of chasing
+ * pointers.
+ */
+struct RobotHotState {
+  // value to hold the hungry timer
+  double hungry{0};
+  // value to hold the starving timer
+  double starving{0};
+  // value to hold the death timer
+  double death_timer{0};
+  // ticks left in the reverse arc after a collision
+  unsigned int arc_ticks{0};
+  // bool value to determine whether the robot is hungry
+  bool is_hungry{false};
+  // bool value to determine whether the robot is starving
+  bool is_starving{false};
+  // bool value to determine whether the robot is dead
+  bool dead{false};
+  // determines whether the robot has collided with anything
+  bool collision_cond{false};
+  // determines whether the food sensors are active
+  bool food_flag{true};
+};
+
+/**
+ * @brief Configuration and presentation data shared by every robot of one
+ * behavior. Rarely read, so it is kept out of the Robot object.
+ */
+struct RobotProfile {
+  RobotBehaviorEnum behavior{kNothing};
+  RgbColor color{};
+  double hunger{0};
+  double starve{0};
+  double death{0};
+  double max_speed{0};
+  double max_angle{0};
+  // bias added to each wheel by the love and explore behaviors
+  double max_sens{0};
+  // range of the radius drawn on a Reset
+  double min_radius{0};
+  double max_radius{0};
+  // length of the reverse arc after a collision, in ticks
+  unsigned int arc_ticks{0};
+  // sensor numerators given to new robots
+  int light_numerator{0};
+  int food_numerator{0};
+  // the wheel speeds as a function of the sensor readings
+  BehaviorMatrix matrix = kFearMatrix;
+  // the learned controller of neural robots
+  NeuralNetwork network{};
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Table of RobotProfile, indexed by RobotBehaviorEnum.
+ *
+ * Robots only keep their behavior enum and a pointer to the table they were
+ * configured from, and look their profile up by index when needed.
+ */
+class RobotProfileTable {
+ public:
+  /**
+   * @brief Constructor filling every profile from params.h.
+   */
+  RobotProfileTable();
+
+  /**
+   * @brief The profile for a behavior. kNothing (or anything out of range)
+   * gives the plain robot profile.
+   */
+  const RobotProfile &get(RobotBehaviorEnum behv) const {
+    return profiles_[index(behv)];
+  }
+
+  /**
+   * @brief Mutable access to a profile, for configuring a table.
+   */
+  RobotProfile &at(RobotBehaviorEnum behv) { return profiles_[index(behv)]; }
+
+  /**
+   * @brief The process wide table built from params.h.
+   */
+  static const RobotProfileTable &Default();
+
+ private:
+  static int index(RobotBehaviorEnum behv) {
+    bool known = behv >= kAggressive && behv < kNumRobotBehaviors;
+    return known ? behv : kNothing;
+  }
+
+  RobotProfile profiles_[kNumRobotBehaviors];
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_ROBOT_STATE_H_
@@ -0,0 +1,162 @@
+/**
+ * @file runner_options.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+#include "src/arena_config.h"
+#include "src/runner_options.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+static RunnerOptionsStatus Fail(RunnerOptionsStatus status,
+                                const std::string &message,
+                                std::string *error) {
+  if (error != nullptr) *error = message;
+  return status;
+}
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+bool ParseCount(const char *text, unsigned long max, unsigned long *value) {
+  if (!std::isdigit(static_cast<unsigned char>(*text))) return false;
+  char *end = nullptr;
+  errno = 0;
+  *value = std::strtoul(text, &end, 10);
+  return *end == '\0' && errno != ERANGE && *value <= max;
+}
+
+bool ParseDimension(const std::string &name, const char *spec,
+                    SweepDimension *dim) {
+  char *end = nullptr;
+  dim->name = name;
+  dim->min = std::strtod(spec, &end);
+  if (*end != ':') return false;
+  dim->max = std::strtod(end + 1, &end);
+  dim->steps = 1;
+  if (*end == ':') {
+    unsigned long steps = 0;
+    if (!ParseCount(end + 1, UINT_MAX, &steps)) return false;
+    dim->steps = static_cast<unsigned int>(steps);
+    return true;
+  }
+  return *end == '\0';
+}
+
+RunnerOptionsStatus ParseRunnerOptions(int argc, const char *const *argv,
+                                       RunnerOptions *options,
+                                       std::string *error) {
+  struct arena_params &params = options->params;
+
+  // the scenario file is loaded before any override, wherever it appears
+  for (int i = 1; i < argc; i++) {
+    if (std::strncmp(argv[i], "config=", 7) != 0) continue;
+    std::string message;
+    if (!LoadArenaParams(argv[i] + 7, &params, &message)) {
+      return Fail(kOptionsBadScenario, message, error);
+    }
+  }
+
+  for (int i = 1; i < argc; i++) {
+    const char *eq = std::strchr(argv[i], '=');
+    if (eq == nullptr) {
+      return Fail(kOptionsBadArgument,
+                  std::string("bad parameter: ") + argv[i], error);
+    }
+    std::string key(argv[i], eq - argv[i]);
+    const char *text = eq + 1;
+    // the runner's own whole number options, checked before use
+    bool count = key == "ticks" || key == "threads" || key == "seed" ||
+                 key == "bench" || key == "step_bench" ||
+                 key == "replicas" || key == "samples" ||
+                 key == "population" || key == "generations";
+    unsigned long max = key == "ticks" || key == "bench" ? ULONG_MAX :
+      UINT_MAX;
+    unsigned long value = 0;
+    if (count && !ParseCount(text, max, &value)) {
+      return Fail(kOptionsBadArgument,
+                  std::string("bad parameter: ") + argv[i], error);
+    }
+    if (key == "config") {
+      continue;
+    } else if (key == "ticks") {
+      options->ticks = value;
+    } else if (key == "threads") {
+      params.n_threads = static_cast<unsigned int>(value);
+    } else if (key == "seed") {
+      params.seed = static_cast<unsigned int>(value);
+    } else if (key == "bench") {
+      options->bench = value;
+    } else if (key == "step_bench") {
+      options->step_bench = value != 0;
+    } else if (key == "replicas") {
+      options->replicas = static_cast<unsigned int>(value);
+    } else if (key == "design") {
+      options->design = std::strcmp(text, "random") == 0 ? kRandomDesign :
+        kGridDesign;
+    } else if (key == "samples") {
+      options->samples = static_cast<unsigned int>(value);
+    } else if (key == "out") {
+      options->out = text;
+    } else if (key == "population") {
+      options->population = static_cast<unsigned int>(value);
+    } else if (key == "generations") {
+      options->generations = static_cast<unsigned int>(value);
+    } else if (key.compare(0, 7, "evolve.") == 0) {
+      SweepDimension gene;
+      struct arena_params probe;
+      if (!ParseDimension(key.substr(7), text, &gene) ||
+          !SweepRunner::ApplyValue(gene.name, gene.min, &probe)) {
+        return Fail(kOptionsBadArgument,
+                    std::string("bad evolved gene: ") + argv[i], error);
+      }
+      options->genes.push_back(gene);
+    } else if (key.compare(0, 6, "sweep.") == 0) {
+      SweepDimension dim;
+      struct arena_params probe;
+      if (!ParseDimension(key.substr(6), text, &dim) ||
+          !SweepRunner::ApplyValue(dim.name, dim.min, &probe)) {
+        return Fail(kOptionsBadArgument,
+                    std::string("bad sweep dimension: ") + argv[i], error);
+      }
+      options->dims.push_back(dim);
+    } else if (!SetArenaParam(key, text, &params)) {
+      return Fail(kOptionsBadArgument,
+                  std::string("bad parameter: ") + argv[i], error);
+    }
+  }
+
+  // a sweep or search may raise a count the base arena leaves at 0
+  struct arena_params widest = params;
+  for (const SweepDimension &dim : options->dims) {
+    SweepRunner::ApplyValue(dim.name, std::max(dim.min, dim.max), &widest);
+  }
+  for (const SweepDimension &gene : options->genes) {
+    SweepRunner::ApplyValue(gene.name, std::max(gene.min, gene.max),
+                            &widest);
+  }
+  std::string message;
+  if (!CheckArenaParams(widest, &message)) {
+    return Fail(kOptionsBadScenario, message, error);
+  }
+  return kOptionsOk;
+}
+
+NAMESPACE_END(csci3081);
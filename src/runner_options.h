@@ -0,0 +1,101 @@
+/**
+ * @file runner_options.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_RUNNER_OPTIONS_H_
+#define SRC_RUNNER_OPTIONS_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <vector>
+
+#include "src/arena_params.h"
+#include "src/common.h"
+#include "src/sweep_runner.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief What ParseRunnerOptions() made of the arguments.
+ */
+enum RunnerOptionsStatus {
+  kOptionsOk,           // every argument applied
+  kOptionsBadArgument,  // an argument is malformed; show the usage text
+  kOptionsBadScenario   // the scenario cannot be loaded or does not fit
+};
+
+/**
+ * @brief Everything one arenarunner invocation was asked to do.
+ */
+struct RunnerOptions {
+  // the arena, from the scenario file and any overrides
+  struct arena_params params{};
+  // maximum ticks of each run (the timed ticks of bench and step_bench)
+  unsigned long ticks{10000};
+  // seeded replicas to run and summarise (0 = a single run)
+  unsigned int replicas{0};
+  // entities of the motion model benchmark (0 = no benchmark)
+  size_t bench{0};
+  bool step_bench{false};
+  // a parameter sweep, run if `dims` is not empty
+  std::vector<SweepDimension> dims{};
+  SweepDesign design{kGridDesign};
+  unsigned int samples{0};
+  std::string out{"sweep.csv"};
+  // a genetic search, run if `genes` is not empty
+  std::vector<SweepDimension> genes{};
+  unsigned int population{16};
+  unsigned int generations{10};
+};
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+/**
+ * @brief Parse a whole number of at most `max`: digits only, with no sign,
+ * spaces or trailing text.
+ *
+ * @return false, with `value` unspecified, if `text` is not such a number.
+ */
+bool ParseCount(const char *text, unsigned long max, unsigned long *value);
+
+/**
+ * @brief Parse "MIN:MAX[:STEPS]" into a sweep dimension called `name`.
+ *
+ * @return false if `spec` is malformed.
+ */
+bool ParseDimension(const std::string &name, const char *spec,
+                    SweepDimension *dim);
+
+/**
+ * @brief Apply arenarunner's `key=value` arguments to `options`.
+ *
+ * A `config=FILE` argument is loaded before any other, wherever it appears,
+ * so the rest override it. The runner's own whole number options (ticks,
+ * threads, seed, bench, step_bench, replicas, samples, population,
+ * generations) must pass ParseCount(); any other key goes to
+ * SetArenaParam(). Once every argument is applied the arena, with each
+ * sweep and evolved dimension at its largest value, must pass
+ * CheckArenaParams().
+ *
+ * @param argc, argv As given to main(); argv[0] is skipped.
+ * @param[in,out] options The defaults, updated by the arguments.
+ * @param[out] error If not null, set to a description of the first problem.
+ */
+RunnerOptionsStatus ParseRunnerOptions(int argc, const char *const *argv,
+                                       RunnerOptions *options,
+                                       std::string *error = nullptr);
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_RUNNER_OPTIONS_H_
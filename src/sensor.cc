@@ -19,7 +19,7 @@ NAMESPACE_BEGIN(csci3081);
  * Constructors/Destructor
  ******************************************************************************/
 Sensor::Sensor() : pose_(), color_(192, 192, 192), robot_(NULL),
-                   reading_(0.0), heading_angle_(0.0) {}
+                   reading_(0.0), heading_angle_(0.0), mount_() {}
 
 Sensor::~Sensor() {}
 
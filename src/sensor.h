@@ -102,7 +102,10 @@ class Sensor{
   /**
   * @brief Command that sets the heading angle of the sensor.
   */
-  void set_heading_angle(double ang) { heading_angle_ = ang; }
+  void set_heading_angle(double ang) {
+    heading_angle_ = ang;
+    mount_ = Heading::FromDegrees(ang);
+  }
 
   /**
   * @brief Command that sets the sensitivity of the sensor.
@@ -140,6 +143,8 @@ class Sensor{
   double reading_;
   // the intial angle of the sensor
   double heading_angle_;
+  // heading_angle_ as a unit vector, to rotate the robot's heading by
+  Heading mount_;
   // the numerator to calculate reading
   int numerator_{1200};
 };
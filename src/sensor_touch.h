@@ -18,6 +18,7 @@
 #include "src/pose.h"
 #include "src/entity_type.h"
 #include "src/arena_entity.h"
+#include "src/memory_accounting.h"
 
 /*******************************************************************************
  * Namespaces
@@ -37,12 +38,12 @@ NAMESPACE_BEGIN(csci3081);
  *
  * SensorTouch can be observed for collision events.
  */
-class SensorTouch {
+class SensorTouch : private Accounted<SensorTouch, kAccountTouchSensor> {
  public:
   /**
    * @brief Constructor.
    */
-  SensorTouch() : point_of_contact_(0, 0) {}
+  SensorTouch() : Accounted(), point_of_contact_(0, 0) {}
 
   /**
    * @brief Getter method for the point of contact.
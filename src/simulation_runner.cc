@@ -0,0 +1,102 @@
+/**
+ * @file simulation_runner.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <chrono>
+
+#include "src/simulation_runner.h"
+#include "src/params.h"
+#include "src/robot.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+SimulationRunner::SimulationRunner(const struct arena_params *params) :
+  arena_(new Arena(params)) {}
+
+SimulationRunner::~SimulationRunner() { delete arena_; }
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+RunResult SimulationRunner::Run(unsigned long max_ticks) {
+  RunResult result;
+  arena_->set_game_status(PLAYING);
+
+  auto start = std::chrono::steady_clock::now();
+  result.ticks = arena_->StepTicks(max_ticks);
+  auto stop = std::chrono::steady_clock::now();
+
+  result.status = arena_->get_game_status();
+  result.entity_updates = result.ticks * arena_->entities().size();
+  result.seconds = std::chrono::duration<double>(stop - start).count();
+  return result;
+}
+
+RunResult SimulationRunner::Benchmark(unsigned long ticks) {
+  RunResult result;
+  arena_->set_game_status(PLAYING);
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned long t = 0; t < ticks; ++t) {
+    arena_->UpdateEntitiesTimestep();
+  }
+  auto stop = std::chrono::steady_clock::now();
+
+  result.ticks = ticks;
+  result.status = arena_->get_game_status();
+  result.entity_updates = ticks * arena_->entities().size();
+  result.seconds = std::chrono::duration<double>(stop - start).count();
+  return result;
+}
+
+void SimulationRunner::Report(const RunResult &result,
+                              std::ostream &out) const {
+  const char *status = "playing";
+  if (result.status == WON) {
+    status = "won";
+  } else if (result.status == LOST) {
+    status = "lost";
+  }
+
+  int dead = 0;
+  int starving = 0;
+  int hungry = 0;
+  for (auto rob : arena_->robots()) {
+    if (rob->get_dead()) {
+      ++dead;
+    } else if (rob->get_is_starving()) {
+      ++starving;
+    } else if (rob->get_is_hungry()) {
+      ++hungry;
+    }
+  }
+
+  out << "ticks:               " << result.ticks << "\n"
+      << "wall time (s):       " << result.seconds << "\n"
+      << "ticks/s:             " << result.ticks_per_second() << "\n"
+      << "steps:               " << arena_->get_steps() << "\n"
+      << "entity updates/s:    " << result.entity_updates_per_second() << "\n"
+      << "threads:             " << arena_->get_num_threads() << "\n"
+      << "contact checks:      " << arena_->get_contact_checks() << " of "
+      << arena_->get_contact_candidates() << "\n"
+      << "status:              " << status << "\n"
+      << "robots:              " << arena_->robots().size() << "\n"
+      << "  hungry:            " << hungry << "\n"
+      << "  starving:          " << starving << "\n"
+      << "  dead:              " << dead << "\n"
+      << "lights:              " << arena_->lights().size() << "\n"
+      << "food:                " << arena_->foods().size() << "\n";
+}
+
+NAMESPACE_END(csci3081);
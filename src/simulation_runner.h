@@ -0,0 +1,112 @@
+/**
+ * @file simulation_runner.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_SIMULATION_RUNNER_H_
+#define SRC_SIMULATION_RUNNER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <ostream>
+
+#include "src/arena.h"
+#include "src/arena_params.h"
+#include "src/common.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief Outcome and throughput of one headless run.
+ */
+struct RunResult {
+  // number of ticks actually stepped
+  unsigned long ticks{0};
+  // sum over ticks of the number of entities updated
+  unsigned long entity_updates{0};
+  // game status when the run stopped (WON, LOST or PLAYING)
+  int status{PLAYING};
+  // wall clock time spent stepping, in seconds
+  double seconds{0};
+
+  /**
+   * @brief Ticks stepped per wall clock second.
+   */
+  double ticks_per_second() const {
+    return seconds > 0 ? ticks / seconds : 0;
+  }
+
+  /**
+   * @brief Entity updates per wall clock second.
+   */
+  double entity_updates_per_second() const {
+    return seconds > 0 ? entity_updates / seconds : 0;
+  }
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Steps an Arena without any graphics.
+ *
+ * The runner owns an Arena built from arena_params and steps it as fast as the
+ * CPU allows, either for a fixed number of ticks or until the game status
+ * leaves PLAYING.
+ */
+class SimulationRunner {
+ public:
+  /**
+   * @brief Build the arena to run.
+   */
+  explicit SimulationRunner(const struct arena_params *params);
+
+  /**
+   * @brief Deletes the arena.
+   */
+  ~SimulationRunner();
+
+  SimulationRunner(const SimulationRunner &other) = delete;
+  SimulationRunner &operator=(const SimulationRunner &other) = delete;
+
+  /**
+   * @brief Step the arena until max_ticks have passed or the game is won or
+   * lost.
+   *
+   * @param max_ticks Upper bound on the number of ticks to step.
+   */
+  RunResult Run(unsigned long max_ticks);
+
+  /**
+   * @brief Time Arena::UpdateEntitiesTimestep() over exactly `ticks` ticks.
+   *
+   * Unlike Run(), the arena keeps stepping after the game is won or lost,
+   * so runs of the same length are comparable whatever happens in them.
+   */
+  RunResult Benchmark(unsigned long ticks);
+
+  /**
+   * @brief Print the run's throughput and the arena's final state.
+   */
+  void Report(const RunResult &result, std::ostream &out) const;
+
+  /**
+   * @brief The arena being run.
+   */
+  const Arena *get_arena() const { return arena_; }
+
+ private:
+  Arena *arena_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_SIMULATION_RUNNER_H_
@@ -0,0 +1,223 @@
+/**
+ * @file sweep_runner.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+
+#include "src/arena_config.h"
+#include "src/sweep_runner.h"
+#include "src/task_graph.h"
+#include "src/thread_pool.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+SweepRunner::SweepRunner(const struct arena_params &base,
+                         const std::vector<SweepDimension> &dims,
+                         SweepDesign design, unsigned int samples,
+                         unsigned int replicas, unsigned long max_ticks,
+                         unsigned int seed, unsigned int n_threads) :
+  base_(base),
+  dims_(dims),
+  design_(design),
+  samples_(samples),
+  replicas_(replicas),
+  max_ticks_(max_ticks),
+  seed_(seed),
+  n_threads_(n_threads) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+size_t SweepRunner::num_configs() const {
+  if (design_ == kRandomDesign) return samples_;
+  size_t n = 1;
+  for (const SweepDimension &dim : dims_) {
+    n *= std::max(dim.steps, 1u);
+  }
+  return n;
+}
+
+std::vector<double> SweepRunner::ConfigValues(size_t index) const {
+  std::vector<double> values;
+  values.reserve(dims_.size());
+  if (design_ == kRandomDesign) {
+    // each configuration has its own generator, so it does not depend on
+    // which configurations ran before it
+    std::minstd_rand rng(seed_ + static_cast<unsigned int>(index));
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (const SweepDimension &dim : dims_) {
+      values.push_back(dim.min + (dim.max - dim.min) * unit(rng));
+    }
+    return values;
+  }
+
+  // grid: the first dimension varies fastest
+  for (const SweepDimension &dim : dims_) {
+    unsigned int steps = std::max(dim.steps, 1u);
+    size_t k = index % steps;
+    index /= steps;
+    double frac = steps > 1 ? static_cast<double>(k) / (steps - 1) : 0.0;
+    values.push_back(dim.min + (dim.max - dim.min) * frac);
+  }
+  return values;
+}
+
+int SweepRunner::Run(const std::string &path) {
+  bool has_header = false;
+  bool mismatch = false;
+  bool torn = false;
+  std::set<size_t> done = ReadCheckpoint(path, &has_header, &mismatch, &torn);
+  if (mismatch) return -2;
+
+  std::ofstream out(path, std::ios::app);
+  if (!out) return -1;
+  if (torn) {
+    // finish the cut off row so the next one starts on its own line
+    out << "\n";
+  }
+  if (!has_header) {
+    WriteHeader(out);
+  }
+  out.flush();
+
+  std::vector<size_t> pending;
+  for (size_t i = 0; i < num_configs(); i++) {
+    if (done.find(i) == done.end()) pending.push_back(i);
+  }
+
+  std::mutex out_mutex;
+  ThreadPool pool(n_threads_);
+  TaskGraph graph;
+  graph.AddRangeTasks(pending.size(), 1,
+    [this, &pending, &out, &out_mutex](size_t begin, size_t end) {
+      for (size_t p = begin; p < end; ++p) {
+        size_t index = pending[p];
+        std::vector<double> values = ConfigValues(index);
+        struct arena_params params = base_;
+        for (size_t d = 0; d < dims_.size(); d++) {
+          ApplyValue(dims_[d].name, values[d], &params);
+        }
+        params.n_threads = 1;
+
+        std::vector<ReplicaResult> results;
+        for (unsigned int r = 0; r < replicas_; r++) {
+          params.seed = seed_ + static_cast<unsigned int>(index) * replicas_
+            + r;
+          results.push_back(EnsembleRunner::RunReplica(params, max_ticks_));
+        }
+        EnsembleSummary summary = EnsembleRunner::Summarize(results);
+
+        // build the row first so the file only ever sees whole lines
+        std::ostringstream row;
+        WriteRow(row, index, values, summary);
+        std::lock_guard<std::mutex> lock(out_mutex);
+        out << row.str();
+        out.flush();
+      }
+    });
+  pool.Run(&graph);
+  return static_cast<int>(pending.size());
+}
+
+bool SweepRunner::ApplyValue(const std::string &name, double value,
+                             struct arena_params *params) {
+  return SetArenaParamValue(name, value, params);
+}
+
+std::set<size_t> SweepRunner::ReadCheckpoint(const std::string &path,
+                                             bool *has_header,
+                                             bool *mismatch,
+                                             bool *torn) const {
+  std::set<size_t> done;
+  std::ifstream in(path);
+  std::string line;
+  // config index, dimensions and 9 summary columns
+  size_t columns = 1 + dims_.size() + 9;
+  *has_header = false;
+  *mismatch = false;
+  *torn = false;
+
+  // the header is written in one go, so the file either has none or
+  // starts with all of it
+  std::ostringstream header;
+  WriteHeader(header);
+  std::istringstream expected(header.str());
+  std::string want;
+  while (std::getline(expected, want)) {
+    if (!std::getline(in, line)) {
+      // an empty file has no header yet; anything else is not this sweep
+      *mismatch = *has_header || !line.empty();
+      return done;
+    }
+    if (in.eof() || line != want) {
+      *mismatch = true;
+      return done;
+    }
+    *has_header = true;
+  }
+
+  while (std::getline(in, line)) {
+    if (in.eof()) {
+      // no newline: the last write was cut off, so the row is run again
+      *torn = !line.empty();
+      break;
+    }
+    size_t commas = 0;
+    for (char c : line) {
+      if (c == ',') ++commas;
+    }
+    if (commas + 1 != columns ||
+        !std::isdigit(static_cast<unsigned char>(line[0]))) continue;
+    done.insert(std::stoul(line));
+  }
+  return done;
+}
+
+void SweepRunner::WriteHeader(std::ostream &out) const {
+  out << "# sweep design=" << (design_ == kRandomDesign ? "random" : "grid")
+      << " samples=" << samples_ << " replicas=" << replicas_
+      << " max_ticks=" << max_ticks_ << " seed=" << seed_;
+  for (const SweepDimension &dim : dims_) {
+    out << " " << dim.name << "=" << dim.min << ":" << dim.max << ":"
+        << dim.steps;
+  }
+  out << "\n";
+  out << "config";
+  for (const SweepDimension &dim : dims_) {
+    out << "," << dim.name;
+  }
+  out << ",replicas,won,lost,survived,loss_rate,mean_first_death,"
+      << "sd_first_death,median_first_death,max_first_death\n";
+}
+
+void SweepRunner::WriteRow(std::ostream &out, size_t index,
+                           const std::vector<double> &values,
+                           const EnsembleSummary &summary) const {
+  out << index;
+  for (double value : values) {
+    out << "," << value;
+  }
+  out << "," << summary.replicas << "," << summary.won << ","
+      << summary.lost << "," << summary.survived << ","
+      << summary.loss_rate() << "," << summary.mean_first_death << ","
+      << summary.stddev_first_death << "," << summary.median_first_death
+      << "," << summary.max_first_death << "\n";
+}
+
+NAMESPACE_END(csci3081);
@@ -0,0 +1,138 @@
+/**
+ * @file sweep_runner.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_SWEEP_RUNNER_H_
+#define SRC_SWEEP_RUNNER_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "src/arena_params.h"
+#include "src/common.h"
+#include "src/ensemble_runner.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/**
+ * @brief How a sweep picks its configurations.
+ */
+enum SweepDesign {
+  kGridDesign,    // every combination of evenly spaced values
+  kRandomDesign   // independent uniform samples from each range
+};
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * @brief One swept tunable and its range.
+ *
+ * `name` is one of the names accepted by SweepRunner::ApplyValue().
+ */
+struct SweepDimension {
+  std::string name{};
+  double min{0};
+  double max{0};
+  // number of grid points, including both ends (grid designs only)
+  unsigned int steps{1};
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief Runs an ensemble for every configuration of a parameter sweep.
+ *
+ * Configurations are numbered, and configuration `i` always has the same
+ * values and seeds, so a sweep can be stopped and resumed. Results are
+ * appended to a CSV file, one row per configuration, as each configuration
+ * finishes; on start up the rows already in the file are skipped. The
+ * configurations are spread over a work-stealing ThreadPool, one task each.
+ */
+class SweepRunner {
+ public:
+  /**
+   * @brief Constructor.
+   *
+   * @param base The arena every configuration starts from.
+   * @param dims The swept tunables.
+   * @param design Grid or random design.
+   * @param samples Number of configurations of a random design.
+   * @param replicas Replicas run per configuration.
+   * @param max_ticks Upper bound on the ticks each replica runs.
+   * @param seed Seed for the random design and the replicas; must not be 0.
+   * @param n_threads Threads running configurations (0 = all hardware
+   * threads).
+   */
+  SweepRunner(const struct arena_params &base,
+              const std::vector<SweepDimension> &dims, SweepDesign design,
+              unsigned int samples, unsigned int replicas,
+              unsigned long max_ticks, unsigned int seed,
+              unsigned int n_threads);
+
+  /**
+   * @brief The number of configurations in the sweep.
+   */
+  size_t num_configs() const;
+
+  /**
+   * @brief The value of every dimension in configuration `index`.
+   */
+  std::vector<double> ConfigValues(size_t index) const;
+
+  /**
+   * @brief Run every configuration not already in the CSV file at `path`,
+   * appending a row for each.
+   *
+   * The file starts with a `#` line recording the design, samples,
+   * replicas, tick limit, seed and dimensions, and then the column names.
+   * An existing file is only resumed if it starts with exactly those
+   * lines, so rows from a different sweep are never taken as done.
+   *
+   * @return The number of configurations run, -1 if the file could not be
+   * opened, or -2 if it holds a different sweep.
+   */
+  int Run(const std::string &path);
+
+  /**
+   * @brief Set a tunable by name.
+   *
+   * Accepts the numeric names of SetArenaParamValue() in arena_config.h.
+   *
+   * @return false if the name is not a tunable.
+   */
+  static bool ApplyValue(const std::string &name, double value,
+                         struct arena_params *params);
+
+ private:
+  std::set<size_t> ReadCheckpoint(const std::string &path, bool *has_header,
+                                  bool *mismatch, bool *torn) const;
+  void WriteHeader(std::ostream &out) const;
+  void WriteRow(std::ostream &out, size_t index,
+                const std::vector<double> &values,
+                const EnsembleSummary &summary) const;
+
+  struct arena_params base_;
+  std::vector<SweepDimension> dims_;
+  SweepDesign design_;
+  unsigned int samples_;
+  unsigned int replicas_;
+  unsigned long max_ticks_;
+  unsigned int seed_;
+  unsigned int n_threads_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_SWEEP_RUNNER_H_
@@ -0,0 +1,53 @@
+/**
+ * @file task_graph.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+
+#include "src/task_graph.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+TaskGraph::TaskId TaskGraph::AddTask(std::function<void()> body) {
+  tasks_.emplace_back(std::move(body));
+  return tasks_.size() - 1;
+}
+
+std::vector<TaskGraph::TaskId> TaskGraph::AddRangeTasks(
+    size_t n, size_t grain, const RangeFunction &body) {
+  std::vector<TaskId> ids;
+  if (n == 0) return ids;
+  size_t chunks = std::max<size_t>(n / std::max<size_t>(grain, 1), 1);
+  ids.reserve(chunks);
+  for (size_t c = 0; c < chunks; c++) {
+    size_t begin = n * c / chunks;
+    size_t end = n * (c + 1) / chunks;
+    ids.push_back(AddTask([body, begin, end]() { body(begin, end); }));
+  }
+  return ids;
+}
+
+void TaskGraph::AddDependency(TaskId before, TaskId after) {
+  tasks_[before].successors.push_back(&tasks_[after]);
+  ++tasks_[after].n_deps;
+}
+
+void TaskGraph::AddDependency(const std::vector<TaskId> &before,
+                              TaskId after) {
+  for (TaskId id : before) {
+    AddDependency(id, after);
+  }
+}
+
+NAMESPACE_END(csci3081);
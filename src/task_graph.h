@@ -0,0 +1,109 @@
+/**
+ * @file task_graph.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_TASK_GRAPH_H_
+#define SRC_TASK_GRAPH_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "src/common.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+class ThreadPool;
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief A directed acyclic graph of tasks, run by ThreadPool::Run().
+ *
+ * A task becomes ready once every task it depends on has finished. A graph
+ * can be run any number of times; building it once and reusing it avoids
+ * allocating on every run.
+ */
+class TaskGraph {
+ public:
+  /**
+   * @brief Identifies a task within its graph.
+   */
+  typedef size_t TaskId;
+
+  /**
+   * @brief The body of a range task, called with [begin, end).
+   */
+  typedef std::function<void(size_t begin, size_t end)> RangeFunction;
+
+  TaskGraph() : tasks_() {}
+
+  TaskGraph(const TaskGraph &other) = delete;
+  TaskGraph &operator=(const TaskGraph &other) = delete;
+
+  /**
+   * @brief Add a task.
+   */
+  TaskId AddTask(std::function<void()> body);
+
+  /**
+   * @brief Split [0, n) into chunks of at least `grain` indices and add one
+   * task per chunk.
+   *
+   * @return The ids of the chunk tasks, in index order. Empty if `n == 0`.
+   */
+  std::vector<TaskId> AddRangeTasks(size_t n, size_t grain,
+                                    const RangeFunction &body);
+
+  /**
+   * @brief Make `after` wait for `before` to finish.
+   */
+  void AddDependency(TaskId before, TaskId after);
+
+  /**
+   * @brief Make `after` wait for every task in `before`.
+   */
+  void AddDependency(const std::vector<TaskId> &before, TaskId after);
+
+  /**
+   * @brief Remove every task.
+   */
+  void Clear() { tasks_.clear(); }
+
+  /**
+   * @brief The number of tasks.
+   */
+  size_t size() const { return tasks_.size(); }
+
+ private:
+  friend class ThreadPool;
+
+  struct Task {
+    explicit Task(std::function<void()> task_body) :
+      body(std::move(task_body)), successors(), n_deps(0), pending(0) {}
+
+    std::function<void()> body;
+    std::vector<Task *> successors;
+    int n_deps;
+    // dependencies left to finish in the current run
+    std::atomic<int> pending;
+  };
+
+  // a deque so tasks never move and can point at each other
+  std::deque<Task> tasks_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_TASK_GRAPH_H_
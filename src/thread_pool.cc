@@ -0,0 +1,175 @@
+/**
+ * @file thread_pool.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+
+#include "src/thread_pool.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+ThreadPool::ThreadPool(unsigned int n_threads, size_t min_chunk) :
+  workers_(),
+  queues_(),
+  min_chunk_(std::max<size_t>(min_chunk, 1)),
+  remaining_(0),
+  mutex_(),
+  work_cv_(),
+  done_cv_(),
+  epoch_(0),
+  busy_(0),
+  stop_(false) {
+  if (n_threads == 0) {
+    n_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  for (unsigned int i = 0; i < n_threads; i++) {
+    queues_.emplace_back(new WorkQueue);
+  }
+  // the calling thread is participant 0
+  for (unsigned int i = 1; i < n_threads; i++) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void ThreadPool::Run(TaskGraph *graph) {
+  if (graph->size() == 0) return;
+
+  for (auto &task : graph->tasks_) {
+    task.pending.store(task.n_deps, std::memory_order_relaxed);
+  }
+  remaining_.store(graph->size());
+
+  // deal the tasks with no dependencies out across the queues
+  unsigned int next = 0;
+  for (auto &task : graph->tasks_) {
+    if (task.n_deps == 0) {
+      Push(next, &task);
+      next = (next + 1) % get_num_threads();
+    }
+  }
+
+  if (!workers_.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++epoch_;
+    }
+    work_cv_.notify_all();
+  }
+
+  Participate(0);
+
+  // workers may still be looking for work; wait until they have left the job
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_cv_.wait(lock, [this]() { return busy_ == 0; });
+}
+
+void ThreadPool::ParallelFor(size_t n, const RangeFunction &body) {
+  size_t chunks = std::min<size_t>(get_num_threads(), n / min_chunk_);
+  if (chunks <= 1) {
+    // serial fallback
+    body(0, n);
+    return;
+  }
+  TaskGraph graph;
+  graph.AddRangeTasks(n, (n + chunks - 1) / chunks, body);
+  Run(&graph);
+}
+
+void ThreadPool::WorkerLoop(unsigned int index) {
+  unsigned long seen = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_cv_.wait(lock, [this, seen]() { return stop_ || epoch_ != seen; });
+      if (stop_) return;
+      seen = epoch_;
+      ++busy_;
+    }
+
+    Participate(index);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --busy_;
+    }
+    done_cv_.notify_all();
+  }
+}
+
+void ThreadPool::Participate(unsigned int index) {
+  while (remaining_.load() > 0) {
+    TaskGraph::Task *task = Pop(index);
+    if (task == nullptr) {
+      task = Steal(index);
+    }
+    if (task == nullptr) {
+      // everything left is waiting on tasks running elsewhere
+      std::this_thread::yield();
+      continue;
+    }
+
+    task->body();
+    for (TaskGraph::Task *succ : task->successors) {
+      if (succ->pending.fetch_sub(1) == 1) {
+        Push(index, succ);
+      }
+    }
+    remaining_.fetch_sub(1);
+  }
+}
+
+void ThreadPool::Push(unsigned int index, TaskGraph::Task *task) {
+  WorkQueue &queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  queue.tasks.push_back(task);
+}
+
+TaskGraph::Task *ThreadPool::Pop(unsigned int index) {
+  WorkQueue &queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) return nullptr;
+  TaskGraph::Task *task = queue.tasks.back();
+  queue.tasks.pop_back();
+  return task;
+}
+
+TaskGraph::Task *ThreadPool::Steal(unsigned int thief) {
+  unsigned int n = get_num_threads();
+  for (unsigned int i = 1; i < n; i++) {
+    WorkQueue &queue = *queues_[(thief + i) % n];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      TaskGraph::Task *task = queue.tasks.front();
+      queue.tasks.pop_front();
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+NAMESPACE_END(csci3081);
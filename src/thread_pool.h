@@ -0,0 +1,125 @@
+/**
+ * @file thread_pool.h
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+#ifndef SRC_THREAD_POOL_H_
+#define SRC_THREAD_POOL_H_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "src/common.h"
+#include "src/task_graph.h"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NAMESPACE_BEGIN(csci3081);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * @brief A persistent, work-stealing pool of worker threads.
+ *
+ * The workers are started once and sleep between jobs. A job is a TaskGraph:
+ * every thread (the caller included) has its own queue of ready tasks, works
+ * from the back of it, and steals from the front of the others' queues when
+ * it runs dry. A finished task pushes the successors it made ready onto its
+ * own thread's queue, so dependent work follows the data it needs without
+ * any thread waiting at a barrier.
+ *
+ * A pool with one thread runs everything on the calling thread.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief The range body, called with a half open range [begin, end).
+   */
+  typedef TaskGraph::RangeFunction RangeFunction;
+
+  /**
+   * @brief Start the workers.
+   *
+   * @param n_threads The number of threads taking part in a job, including
+   * the caller. 0 uses every hardware thread; 1 never starts a worker.
+   * @param min_chunk The smallest chunk ParallelFor gives to a thread.
+   */
+  explicit ThreadPool(unsigned int n_threads, size_t min_chunk = 1);
+
+  /**
+   * @brief Stop and join the workers.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &other) = delete;
+  ThreadPool &operator=(const ThreadPool &other) = delete;
+
+  /**
+   * @brief Run every task of a graph, respecting its dependencies, and return
+   * once all have finished. Not reentrant: call from one thread at a time.
+   */
+  void Run(TaskGraph *graph);
+
+  /**
+   * @brief Run `body` over [0, n), split into one chunk per thread.
+   *
+   * Each index is visited by exactly one thread, so a body that only writes
+   * to the elements of its own range gives the same results as a serial loop.
+   * A range too small to split runs serially on the calling thread.
+   */
+  void ParallelFor(size_t n, const RangeFunction &body);
+
+  /**
+   * @brief The number of threads taking part in a job, including the caller.
+   */
+  unsigned int get_num_threads() const {
+    return static_cast<unsigned int>(workers_.size()) + 1;
+  }
+
+ private:
+  // One participant's ready tasks.
+  struct WorkQueue {
+    WorkQueue() : mutex(), tasks() {}
+
+    std::mutex mutex;
+    std::deque<TaskGraph::Task *> tasks;
+  };
+
+  void WorkerLoop(unsigned int index);
+  void Participate(unsigned int index);
+  void Push(unsigned int index, TaskGraph::Task *task);
+  TaskGraph::Task *Pop(unsigned int index);
+  TaskGraph::Task *Steal(unsigned int thief);
+
+  std::vector<std::thread> workers_;
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+  size_t min_chunk_;
+
+  // tasks of the current job not yet finished
+  std::atomic<size_t> remaining_;
+
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  // guarded by mutex_
+  unsigned long epoch_;
+  unsigned int busy_;
+  bool stop_;
+};
+
+NAMESPACE_END(csci3081);
+
+#endif  // SRC_THREAD_POOL_H_
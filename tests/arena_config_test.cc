@@ -0,0 +1,113 @@
+/**
+ * @file arena_config_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_config.h"
+#include "../src/arena_params.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef ARENA_CONFIG_TEST
+
+class ArenaConfigTest : public ::testing::Test {
+ public:
+  ArenaConfigTest() {}
+};
+
+// A scenario file configures the entities the arena builds
+TEST_F(ArenaConfigTest, ScenarioFileConfiguresArena) {
+  std::string path = ::testing::TempDir() + "arena_config_test.txt";
+  {
+    std::ofstream out(path);
+    out << "# test scenario\n"
+        << "fear = 4\n"
+        << "explore = 0\n"
+        << "robot_min_radius = 12   # fixed radius\n"
+        << "robot_max_radius = 12\n"
+        << "robot_max_speed = 6\n"
+        << "numerator = 800\n"
+        << "food_radius = 9\n"
+        << "light_speed = 2.5\n"
+        << "fear_color = 1,2,3\n";
+  }
+  csci3081::arena_params params;
+  std::string error;
+  ASSERT_TRUE(csci3081::LoadArenaParams(path, &params, &error)) << error;
+  EXPECT_TRUE(csci3081::SetArenaParam("seed", "5", &params))
+    << "\nFAIL ScenarioFileConfiguresArena: override\n";
+  EXPECT_FALSE(csci3081::SetArenaParam("food_radius", "big", &params))
+    << "\nFAIL ScenarioFileConfiguresArena: bad value\n";
+  EXPECT_FALSE(csci3081::SetArenaParam("bogus", "1", &params))
+    << "\nFAIL ScenarioFileConfiguresArena: unknown name\n";
+
+  csci3081::Arena arena(&params);
+  ASSERT_EQ(arena.robots().size(), 4u)
+    << "\nFAIL ScenarioFileConfiguresArena: robot count\n";
+  for (auto robot : arena.robots()) {
+    EXPECT_EQ(robot->get_radius(), 12)
+      << "\nFAIL ScenarioFileConfiguresArena: robot radius\n";
+    EXPECT_EQ(robot->get_color().b, 3)
+      << "\nFAIL ScenarioFileConfiguresArena: robot colour\n";
+    EXPECT_EQ(robot->get_left_light_sensor()->get_numerator(), 800)
+      << "\nFAIL ScenarioFileConfiguresArena: sensor numerator\n";
+  }
+  for (auto food : arena.foods()) {
+    EXPECT_EQ(food->get_radius(), 9)
+      << "\nFAIL ScenarioFileConfiguresArena: food radius\n";
+  }
+  for (auto light : arena.lights()) {
+    EXPECT_EQ(light->get_speed(), 2.5)
+      << "\nFAIL ScenarioFileConfiguresArena: light speed\n";
+  }
+
+  {
+    std::ofstream out(path);
+    out << "fear 4\n";
+  }
+  EXPECT_FALSE(csci3081::LoadArenaParams(path, &params, &error))
+    << "\nFAIL ScenarioFileConfiguresArena: malformed line\n";
+  std::remove(path.c_str());
+}
+
+// Neural robots are refused until a weights file gives them a network
+TEST_F(ArenaConfigTest, NeuralRobotsNeedWeights) {
+  csci3081::arena_params params;
+  std::string error;
+  EXPECT_TRUE(csci3081::CheckArenaParams(params, &error)) << error;
+  ASSERT_TRUE(csci3081::SetArenaParam("neural", "3", &params))
+    << "\nFAIL NeuralRobotsNeedWeights: count\n";
+  EXPECT_FALSE(csci3081::CheckArenaParams(params, &error))
+    << "\nFAIL NeuralRobotsNeedWeights: accepted without weights\n";
+  EXPECT_NE(error.find("neural_weights"), std::string::npos)
+    << "\nFAIL NeuralRobotsNeedWeights: message " << error << "\n";
+
+  std::string path = ::testing::TempDir() + "arena_config_test.txt";
+  {
+    std::ofstream out(path);
+    out << "0  # no hidden units, two zero biases\n0 0\n";
+  }
+  EXPECT_FALSE(csci3081::SetArenaParam("neural_weights", path + ".missing",
+                                       &params))
+    << "\nFAIL NeuralRobotsNeedWeights: missing file loaded\n";
+  EXPECT_FALSE(csci3081::CheckArenaParams(params))
+    << "\nFAIL NeuralRobotsNeedWeights: failed load counted\n";
+  ASSERT_TRUE(csci3081::SetArenaParam("neural_weights", path, &params))
+    << "\nFAIL NeuralRobotsNeedWeights: weights not loaded\n";
+  EXPECT_TRUE(csci3081::CheckArenaParams(params))
+    << "\nFAIL NeuralRobotsNeedWeights: refused with weights\n";
+  std::remove(path.c_str());
+}
+
+#endif
@@ -0,0 +1,415 @@
+/**
+ * @file arena_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_params.h"
+#include "../src/entity_view.h"
+#include "../src/light.h"
+#include "../src/robot.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef ARENA_TEST
+
+class ArenaTest : public ::testing::Test {
+ public:
+  ArenaTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+    arena = new csci3081::Arena(&aparams);
+  }
+
+  virtual void TearDown() { delete arena; }
+
+  csci3081::arena_params aparams;
+  csci3081::Arena *arena{nullptr};
+};
+
+// Views cover the same entities as the vectors, without copying them
+TEST_F(ArenaTest, ViewsMatchContents) {
+  EXPECT_EQ(arena->entities().size(), 10u) << "\nFAIL ViewsMatchContents\n";
+  EXPECT_EQ(arena->robots().size(), 5u) << "\nFAIL ViewsMatchContents\n";
+  EXPECT_EQ(arena->lights().size(), 3u) << "\nFAIL ViewsMatchContents\n";
+  EXPECT_EQ(arena->foods().size(), 2u) << "\nFAIL ViewsMatchContents\n";
+  EXPECT_EQ(arena->mobile_entities().size(), 8u)
+    << "\nFAIL ViewsMatchContents\n";
+  EXPECT_EQ(arena->robots().begin(), arena->Robot_Vector().data())
+    << "\nFAIL ViewsMatchContents: view should alias the vector\n";
+}
+
+// The type filtered view only visits the requested type
+TEST_F(ArenaTest, TypeFilteredView) {
+  int lights = 0;
+  for (auto ent : arena->entities_of_type(csci3081::kLight)) {
+    EXPECT_EQ(ent->get_type(), csci3081::kLight)
+      << "\nFAIL TypeFilteredView: wrong type\n";
+    ++lights;
+  }
+  EXPECT_EQ(lights, 3) << "\nFAIL TypeFilteredView: count\n";
+}
+
+// Adding and removing entities bumps the generation
+TEST_F(ArenaTest, GenerationCounter) {
+  unsigned int gen = arena->get_generation();
+  csci3081::EntityView<csci3081::Robot> before = arena->robots();
+  arena->ChangeNumLights(4);
+  EXPECT_GT(arena->get_generation(), gen) << "\nFAIL GenerationCounter\n";
+  gen = arena->get_generation();
+  arena->ChangeNumRobot(1, csci3081::kFear);
+  EXPECT_GT(arena->get_generation(), gen) << "\nFAIL GenerationCounter\n";
+  EXPECT_NE(before.get_generation(), arena->robots().get_generation())
+    << "\nFAIL GenerationCounter: stale view not detected\n";
+}
+
+// Bulk spawning places every entity with its behavior and counts it once
+TEST_F(ArenaTest, BulkSpawn) {
+  arena->ChangeNumRobot(1000, csci3081::kLove);
+  arena->ChangeNumLights(500);
+  EXPECT_EQ(arena->robots().size(), 1005u) << "\nFAIL BulkSpawn: robots\n";
+  EXPECT_EQ(arena->lights().size(), 500u) << "\nFAIL BulkSpawn: lights\n";
+  EXPECT_EQ(arena->mobile_entities().size(), 1505u)
+    << "\nFAIL BulkSpawn: mobile entities\n";
+  EXPECT_EQ(arena->entities().size(), 1507u)
+    << "\nFAIL BulkSpawn: entities\n";
+  int love = 0;
+  for (auto rob : arena->robots()) {
+    if (rob->get_behavior_enum() == csci3081::kLove) {
+      EXPECT_EQ(rob->get_color().b, 234)
+        << "\nFAIL BulkSpawn: color\n";
+      ++love;
+    }
+  }
+  EXPECT_EQ(love, 1000) << "\nFAIL BulkSpawn: behavior\n";
+}
+
+// The reverse arc lasts a fixed number of ticks, however fast we step
+TEST_F(ArenaTest, ArcTimerCountsTicks) {
+  csci3081::Robot *rob = arena->robots()[0];
+  rob->set_collision_cond(true);
+  rob->set_collision_timer();
+  for (int i = 0; i < ARC_TICKS; i++) {
+    rob->TimestepUpdate(1);
+    EXPECT_TRUE(rob->get_collision_cond())
+      << "\nFAIL ArcTimerCountsTicks: arc ended early\n";
+  }
+  rob->TimestepUpdate(1);
+  EXPECT_FALSE(rob->get_collision_cond())
+    << "\nFAIL ArcTimerCountsTicks: arc did not end\n";
+
+  unsigned long tick = arena->get_tick();
+  arena->UpdateEntitiesTimestep();
+  EXPECT_EQ(arena->get_tick(), tick + 1) << "\nFAIL ArcTimerCountsTicks\n";
+}
+
+// AdvanceTime runs whole ticks and carries the remainder
+TEST_F(ArenaTest, AdvanceTimeSubsteps) {
+  arena->ChangeNumRobot(0, csci3081::kFear);
+  arena->ChangeNumRobot(0, csci3081::kAggressive);
+  arena->ChangeNumRobot(0, csci3081::kExplore);
+  arena->AdvanceTime(TICK_TIME * 2.5);
+  EXPECT_EQ(arena->get_tick(), 2u) << "\nFAIL AdvanceTimeSubsteps\n";
+  arena->AdvanceTime(TICK_TIME * 0.6);
+  EXPECT_EQ(arena->get_tick(), 3u)
+    << "\nFAIL AdvanceTimeSubsteps: remainder not carried\n";
+  arena->AdvanceTime(TICK_TIME * (MAX_SUBSTEPS + 10));
+  EXPECT_EQ(arena->get_tick(), 3u + MAX_SUBSTEPS)
+    << "\nFAIL AdvanceTimeSubsteps: substeps not capped\n";
+  EXPECT_EQ(arena->StepTicks(500), 500u)
+    << "\nFAIL AdvanceTimeSubsteps: StepTicks\n";
+  EXPECT_LT(arena->StepTicks(1000000, 0.001), 1000000u)
+    << "\nFAIL AdvanceTimeSubsteps: budget ignored\n";
+}
+
+// Skipping contact checks for entities that cannot touch anything yet gives
+// exactly the fixed tick result
+TEST_F(ArenaTest, EventDrivenMatchesFixedTicks) {
+  aparams.seed = 11;
+  aparams.n_threads = 1;
+  aparams.x_dim = 2400;
+  aparams.y_dim = 1900;
+  csci3081::Arena fixed(&aparams);
+  csci3081::Arena events(&aparams);
+  fixed.set_event_driven(false);
+  events.set_event_driven(true);
+  EXPECT_EQ(fixed.StepTicks(2000), events.StepTicks(2000))
+    << "\nFAIL EventDrivenMatchesFixedTicks: ticks\n";
+  for (size_t i = 0; i < fixed.entities().size(); i++) {
+    csci3081::Pose a = fixed.entities()[i]->get_pose();
+    csci3081::Pose b = events.entities()[i]->get_pose();
+    EXPECT_TRUE(a.x == b.x && a.y == b.y && a.theta == b.theta)
+      << "\nFAIL EventDrivenMatchesFixedTicks: entity " << i << "\n";
+  }
+  EXPECT_EQ(fixed.get_contact_checks(), fixed.get_contact_candidates())
+    << "\nFAIL EventDrivenMatchesFixedTicks: fixed ticks skipped a check\n";
+  EXPECT_LT(events.get_contact_checks(), events.get_contact_candidates() / 2)
+    << "\nFAIL EventDrivenMatchesFixedTicks: nothing skipped\n";
+}
+
+// The cached Heading agrees with the pose, and sensors sit on the rim
+TEST_F(ArenaTest, HeadingFollowsPose) {
+  csci3081::Robot *rob = arena->robots()[0];
+  rob->set_pose(csci3081::Pose(300, 300, 30));
+  EXPECT_NEAR(rob->get_heading().dx, std::sqrt(3) / 2, 1e-15)
+    << "\nFAIL HeadingFollowsPose: set_pose\n";
+  rob->RelativeChangeHeading(+180);
+  EXPECT_NEAR(rob->get_heading().dy, -0.5, 1e-15)
+    << "\nFAIL HeadingFollowsPose: RelativeChangeHeading\n";
+  rob->set_heading(-90);
+  EXPECT_NEAR(rob->get_heading().radians, -M_PI / 2, 1e-15)
+    << "\nFAIL HeadingFollowsPose: set_heading\n";
+
+  arena->StepTicks(200);
+  for (csci3081::Robot *r : arena->robots()) {
+    double rad = csci3081::deg2rad(r->get_pose().theta);
+    EXPECT_NEAR(r->get_heading().radians, rad, 1e-12)
+      << "\nFAIL HeadingFollowsPose: radians of robot " << r->get_id() << "\n";
+    EXPECT_NEAR(r->get_heading().dx, std::cos(rad), 1e-12)
+      << "\nFAIL HeadingFollowsPose: dx of robot " << r->get_id() << "\n";
+    EXPECT_NEAR(r->get_heading().dy, std::sin(rad), 1e-12)
+      << "\nFAIL HeadingFollowsPose: dy of robot " << r->get_id() << "\n";
+    csci3081::LightSensor *sensor = r->get_left_light_sensor();
+    sensor->Update_Pose();
+    double angle = rad + csci3081::deg2rad(sensor->get_heading_angle());
+    EXPECT_NEAR(sensor->get_pose().x,
+                r->get_pose().x + r->get_radius() * std::cos(angle), 1e-9)
+      << "\nFAIL HeadingFollowsPose: sensor of robot " << r->get_id() << "\n";
+    EXPECT_NEAR(sensor->get_pose().y,
+                r->get_pose().y + r->get_radius() * std::sin(angle), 1e-9)
+      << "\nFAIL HeadingFollowsPose: sensor of robot " << r->get_id() << "\n";
+  }
+}
+
+// Adaptive steps cover the ticks asked for in fewer steps, stay close to
+// single ticks and never let an entity pass through a wall
+TEST_F(ArenaTest, AdaptiveStepTracksFixedTicks) {
+  aparams.seed = 11;
+  aparams.n_threads = 1;
+  aparams.x_dim = 2400;
+  aparams.y_dim = 1900;
+  // long reverse arcs carry robots clear of what they hit, so they spend
+  // fewer ticks close enough to touch and steps can grow
+  aparams.arc_ticks = 10;
+  csci3081::Arena fixed(&aparams);
+  csci3081::Arena adaptive(&aparams);
+  adaptive.set_adaptive_step(true);
+  EXPECT_EQ(adaptive.StepTicks(60), 60u)
+    << "\nFAIL AdaptiveStepTracksFixedTicks: ticks\n";
+  fixed.StepTicks(60);
+  for (size_t i = 0; i < fixed.entities().size(); i++) {
+    csci3081::Pose a = fixed.entities()[i]->get_pose();
+    csci3081::Pose b = adaptive.entities()[i]->get_pose();
+    EXPECT_NEAR(a.x, b.x, 2.0)
+      << "\nFAIL AdaptiveStepTracksFixedTicks: x of entity " << i << "\n";
+    EXPECT_NEAR(a.y, b.y, 2.0)
+      << "\nFAIL AdaptiveStepTracksFixedTicks: y of entity " << i << "\n";
+  }
+
+  adaptive.StepTicks(940);
+  EXPECT_EQ(adaptive.get_tick(), 1000u)
+    << "\nFAIL AdaptiveStepTracksFixedTicks: clock\n";
+  EXPECT_LT(adaptive.get_steps(), 900u)
+    << "\nFAIL AdaptiveStepTracksFixedTicks: no ticks combined\n";
+  for (auto ent : adaptive.mobile_entities()) {
+    EXPECT_TRUE(ent->get_pose().x > 0 && ent->get_pose().x < aparams.x_dim &&
+                ent->get_pose().y > 0 && ent->get_pose().y < aparams.y_dim)
+      << "\nFAIL AdaptiveStepTracksFixedTicks: entity " << ent->get_id()
+      << " left the arena\n";
+  }
+}
+
+// Over a short run, cruising lights placed on their straight path end
+// within rounding of where integrating them every tick puts them, and
+// leave their flight when disturbed
+TEST_F(ArenaTest, BallisticLightsMatchIntegration) {
+  aparams.seed = 11;
+  aparams.n_threads = 1;
+  aparams.ballistic_lights = false;
+  csci3081::Arena integrated(&aparams);
+  aparams.ballistic_lights = true;
+  csci3081::Arena ballistic(&aparams);
+  integrated.StepTicks(400);
+  ballistic.StepTicks(400);
+  int flying = 0;
+  for (size_t i = 0; i < ballistic.lights().size(); i++) {
+    csci3081::Light *light = ballistic.lights()[i];
+    flying += light->InFlight();
+    EXPECT_NEAR(light->get_pose().x, integrated.lights()[i]->get_pose().x,
+                1e-6) << "\nFAIL BallisticLightsMatchIntegration: x of "
+                      << i << "\n";
+    EXPECT_NEAR(light->get_pose().y, integrated.lights()[i]->get_pose().y,
+                1e-6) << "\nFAIL BallisticLightsMatchIntegration: y of "
+                      << i << "\n";
+  }
+  EXPECT_GT(flying, 0) << "\nFAIL BallisticLightsMatchIntegration: no light "
+                       << "in flight\n";
+
+  csci3081::Light light;
+  light.set_pose(csci3081::Pose(100, 100, 90));
+  light.Launch(10);
+  ASSERT_TRUE(light.InFlight())
+    << "\nFAIL BallisticLightsMatchIntegration: launch\n";
+  light.Fly(14);
+  EXPECT_NEAR(light.get_pose().y, 100 + 4 * LIGHT_SPEED, 1e-12)
+    << "\nFAIL BallisticLightsMatchIntegration: fly\n";
+  light.RelativeChangeHeading(-5);
+  EXPECT_FALSE(light.InFlight())
+    << "\nFAIL BallisticLightsMatchIntegration: turned in flight\n";
+}
+
+// A new game places entities over the whole configured arena, with radii in
+// the configured ranges
+TEST_F(ArenaTest, ResetPlacesInConfiguredArena) {
+  csci3081::arena_params params = aparams;
+  params.x_dim = 3000;
+  params.y_dim = 2500;
+  params.n_foods = 60;
+  params.robot_min_radius = 11;
+  params.robot_max_radius = 13;
+  csci3081::Arena big(&params);
+  big.Reset();
+  double far_x = 0, far_y = 0;
+  for (csci3081::ArenaEntity *ent : big.entities()) {
+    far_x = std::max(far_x, ent->get_pose().x);
+    far_y = std::max(far_y, ent->get_pose().y);
+    EXPECT_LT(ent->get_pose().x, params.x_dim)
+      << "\nFAIL ResetPlacesInConfiguredArena: outside the arena\n";
+  }
+  EXPECT_GT(far_x, 950) << "\nFAIL ResetPlacesInConfiguredArena: x\n";
+  EXPECT_GT(far_y, 700) << "\nFAIL ResetPlacesInConfiguredArena: y\n";
+  for (csci3081::Robot *rob : big.robots()) {
+    EXPECT_GE(rob->get_radius(), 11)
+      << "\nFAIL ResetPlacesInConfiguredArena: radius\n";
+    EXPECT_LE(rob->get_radius(), 13)
+      << "\nFAIL ResetPlacesInConfiguredArena: radius\n";
+  }
+}
+
+// A reset arena is placed from its own seed, whatever the libc rand() state
+TEST_F(ArenaTest, ResetIsReproducibleFromSeed) {
+  aparams.seed = 42;
+  csci3081::Arena a(&aparams);
+  csci3081::Arena b(&aparams);
+  a.StepTicks(50);
+  b.StepTicks(50);
+  srand(1);
+  a.Reset();
+  srand(2);
+  rand();
+  b.Reset();
+  ASSERT_EQ(a.entities().size(), b.entities().size())
+    << "\nFAIL ResetIsReproducibleFromSeed\n";
+  for (size_t i = 0; i < a.entities().size(); i++) {
+    EXPECT_EQ(a.entities()[i]->get_pose().x, b.entities()[i]->get_pose().x)
+      << "\nFAIL ResetIsReproducibleFromSeed: pose\n";
+    EXPECT_EQ(a.entities()[i]->get_pose().y, b.entities()[i]->get_pose().y)
+      << "\nFAIL ResetIsReproducibleFromSeed: pose\n";
+    EXPECT_EQ(a.entities()[i]->get_radius(), b.entities()[i]->get_radius())
+      << "\nFAIL ResetIsReproducibleFromSeed: radius\n";
+  }
+}
+
+// A reverse arc runs in single tick substeps of its own, without holding
+// the rest of a sparse arena to single ticks
+TEST_F(ArenaTest, AdaptiveStepSubstepsReverseArcs) {
+  aparams.seed = 11;
+  aparams.n_threads = 1;
+  aparams.x_dim = 4000;
+  aparams.y_dim = 3000;
+  aparams.n_lights = 0;
+  aparams.n_foods = 0;
+  aparams.n_fear_robots = 1;
+  aparams.n_aggressive_robots = 0;
+  aparams.n_explore_robots = 0;
+  aparams.n_love_robots = 0;
+  csci3081::Arena fixed(&aparams);
+  csci3081::Arena adaptive(&aparams);
+  adaptive.set_adaptive_step(true);
+  fixed.StepTicks(8);
+  adaptive.StepTicks(8);
+  for (csci3081::Arena *a : {&fixed, &adaptive}) {
+    a->robots()[0]->set_collision_cond(true);
+    a->robots()[0]->set_arc_ticks(10);
+  }
+  unsigned long steps = adaptive.get_steps();
+  adaptive.StepTicks(40);
+  fixed.StepTicks(40);
+  EXPECT_LT(adaptive.get_steps() - steps, 20u)
+    << "\nFAIL AdaptiveStepSubstepsReverseArcs: pinned to single ticks\n";
+  csci3081::Pose a = fixed.robots()[0]->get_pose();
+  csci3081::Pose b = adaptive.robots()[0]->get_pose();
+  EXPECT_NEAR(a.x, b.x, 1e-6)
+    << "\nFAIL AdaptiveStepSubstepsReverseArcs: x\n";
+  EXPECT_NEAR(a.y, b.y, 1e-6)
+    << "\nFAIL AdaptiveStepSubstepsReverseArcs: y\n";
+  EXPECT_NEAR(a.theta, b.theta, 1e-6)
+    << "\nFAIL AdaptiveStepSubstepsReverseArcs: heading\n";
+}
+
+// The pooled update gives the same bits as a serial one, in the default
+// double precision mode, for an arena of several chunks of robots
+TEST_F(ArenaTest, ParallelUpdateMatchesSerial) {
+  aparams.seed = 23;
+  aparams.x_dim = 3000;
+  aparams.y_dim = 2500;
+  aparams.n_lights = 8;
+  aparams.n_fear_robots = PARALLEL_MIN_CHUNK;
+  aparams.n_explore_robots = PARALLEL_MIN_CHUNK / 2;
+  aparams.n_love_robots = PARALLEL_MIN_CHUNK / 4;
+  aparams.n_aggressive_robots = PARALLEL_MIN_CHUNK / 4 + 1;
+  aparams.n_threads = 1;
+  csci3081::Arena serial(&aparams);
+  aparams.n_threads = 4;
+  csci3081::Arena pooled(&aparams);
+  ASSERT_FALSE(serial.get_fixed_point())
+    << "\nFAIL ParallelUpdateMatchesSerial: mode\n";
+  ASSERT_GT(serial.robots().size(), 2u * PARALLEL_MIN_CHUNK)
+    << "\nFAIL ParallelUpdateMatchesSerial: single chunk\n";
+  EXPECT_EQ(serial.StepTicks(30), pooled.StepTicks(30))
+    << "\nFAIL ParallelUpdateMatchesSerial: ticks\n";
+
+  ASSERT_EQ(serial.entities().size(), pooled.entities().size())
+    << "\nFAIL ParallelUpdateMatchesSerial: entities\n";
+  for (size_t i = 0; i < serial.entities().size(); i++) {
+    csci3081::Pose a = serial.entities()[i]->get_pose();
+    csci3081::Pose b = pooled.entities()[i]->get_pose();
+    EXPECT_TRUE(a.x == b.x && a.y == b.y && a.theta == b.theta)
+      << "\nFAIL ParallelUpdateMatchesSerial: pose of entity " << i << "\n";
+  }
+  for (size_t i = 0; i < serial.robots().size(); i++) {
+    csci3081::Robot *a = serial.robots()[i];
+    csci3081::Robot *b = pooled.robots()[i];
+    EXPECT_TRUE(a->get_velocity().left == b->get_velocity().left &&
+                a->get_velocity().right == b->get_velocity().right)
+      << "\nFAIL ParallelUpdateMatchesSerial: velocity of robot " << i
+      << "\n";
+    EXPECT_TRUE(a->get_hungry() == b->get_hungry() &&
+                a->get_starving() == b->get_starving() &&
+                a->get_death_timer() == b->get_death_timer())
+      << "\nFAIL ParallelUpdateMatchesSerial: timers of robot " << i << "\n";
+    EXPECT_EQ(a->get_is_hungry(), b->get_is_hungry())
+      << "\nFAIL ParallelUpdateMatchesSerial: hunger of robot " << i << "\n";
+    EXPECT_EQ(a->get_is_starving(), b->get_is_starving())
+      << "\nFAIL ParallelUpdateMatchesSerial: starving of robot " << i
+      << "\n";
+  }
+}
+
+#endif
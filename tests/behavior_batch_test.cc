@@ -0,0 +1,80 @@
+/**
+ * @file behavior_batch_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_params.h"
+#include "../src/behavior_batch.h"
+#include "../src/motion_handler_robot.h"
+#include "../src/robot.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef BEHAVIOR_BATCH_TEST
+
+class BehaviorBatchTest : public ::testing::Test {
+ public:
+  BehaviorBatchTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+    arena = new csci3081::Arena(&aparams);
+  }
+
+  virtual void TearDown() { delete arena; }
+
+  csci3081::arena_params aparams;
+  csci3081::Arena *arena{nullptr};
+};
+
+// A robot decided in a batch gets the velocity its own behavior gives it
+TEST_F(BehaviorBatchTest, BehaviorBatchMatchesMovement) {
+  csci3081::Robot *rob = arena->robots()[0];
+  csci3081::BehaviorBatch batch;
+  batch.Resize(1);
+  const csci3081::RobotBehaviorEnum behaviors[] = {
+    csci3081::kAggressive, csci3081::kExplore, csci3081::kLove,
+    csci3081::kFear};
+  for (csci3081::RobotBehaviorEnum behv : behaviors) {
+    csci3081::MotionHandlerRobot handler(rob);
+    handler.CreateBehavior(behv);
+    handler.get_behavior()->set_max_sens(rob->get_motion_handler()
+                                         ->get_behavior()->get_max_sens());
+    for (int k = 0; k < 16; k++) {
+      double light_left = 0.7 * k, light_right = 11 - 0.3 * k;
+      double food_left = 0.2 * k, food_right = 5 - 0.25 * k;
+      rob->set_hunger_state(10, 10, 10, k % 4 > 0, k % 4 > 2);
+      rob->get_left_light_sensor()->set_reading(light_left);
+      rob->get_right_light_sensor()->set_reading(light_right);
+      rob->get_left_food_sensor()->set_reading(food_left);
+      rob->get_right_food_sensor()->set_reading(food_right);
+      rob->get_motion_handler()->get_behavior()->set_matrix(
+        handler.get_behavior()->get_matrix());
+      batch.Load(0, rob);
+      batch.Decide(0, 1);
+      csci3081::WheelVelocity want = rob->get_is_starving() ?
+        csci3081::WheelVelocity(0.4 * food_right, 0.4 * food_left) :
+        handler.get_behavior()->Movement(light_left, light_right, food_left,
+                                         food_right, rob->get_is_hungry());
+      EXPECT_NEAR(batch.get_velocity(0).left, want.left, 0)
+        << "\nFAIL BehaviorBatchMatchesMovement: behavior " << behv << "\n";
+      EXPECT_NEAR(batch.get_velocity(0).right, want.right, 0)
+        << "\nFAIL BehaviorBatchMatchesMovement: behavior " << behv << "\n";
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @file behavior_matrix_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_config.h"
+#include "../src/arena_params.h"
+#include "../src/behavior_matrix.h"
+#include "../src/robot.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef BEHAVIOR_MATRIX_TEST
+
+class BehaviorMatrixTest : public ::testing::Test {
+ public:
+  BehaviorMatrixTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+  }
+
+  csci3081::arena_params aparams;
+};
+
+// The presets reproduce the original Braitenberg formulas, and a matrix
+// set from text drives the robots of its behavior
+TEST_F(BehaviorMatrixTest, BehaviorMatrixPresetsAndConfig) {
+  double ll = 3, lr = 7, fl = 2, fr = 5, ms = 40;
+  csci3081::WheelVelocity fear =
+    csci3081::kFearMatrix.Apply(ll, lr, fl, fr, true, ms);
+  EXPECT_NEAR(fear.left, 0.5 * fr + 0.5 * ll, 0)
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: fear left\n";
+  EXPECT_NEAR(fear.right, 0.5 * fl + 0.5 * lr, 0)
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: fear right\n";
+  csci3081::WheelVelocity love =
+    csci3081::kLoveMatrix.Apply(ll, lr, fl, fr, false, ms);
+  EXPECT_NEAR(love.left, ms - 0.5 * ll, 0)
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: love left\n";
+  EXPECT_NEAR(love.right, ms - 0.5 * lr, 0)
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: love right\n";
+
+  csci3081::BehaviorMatrix matrix = csci3081::kFearMatrix;
+  EXPECT_FALSE(csci3081::ParseBehaviorMatrix("1,2,3", &matrix))
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: too few numbers parsed\n";
+  EXPECT_FALSE(csci3081::ParseBehaviorMatrix("0,0,0,0,0,1,0,0,0,0,0,2,3",
+                                             &matrix))
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: too many numbers parsed\n";
+  EXPECT_NEAR(matrix.weights[0][1], 0.5, 0)
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: bad text changed matrix\n";
+
+  // a behavior that ignores its sensors and spins on the spot
+  csci3081::arena_params params = aparams;
+  EXPECT_TRUE(csci3081::SetArenaParam("fear_matrix",
+                                      "0,0,0,0,0,2, 0,0,0,0,0,-2", &params))
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: matrix not parsed\n";
+  EXPECT_FALSE(csci3081::SetArenaParam("love_matrix", "1,2", &params))
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: bad matrix accepted\n";
+  csci3081::Arena spin(&params);
+  csci3081::Robot *rob = spin.robots()[0];
+  rob->set_behavior_enum(csci3081::kFear);
+  rob->set_behavior_handler();
+  csci3081::WheelVelocity spun =
+    rob->get_motion_handler()->get_behavior()->Movement(3, 7, 2, 5, false);
+  EXPECT_NEAR(spun.left, 2, 0)
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: custom left\n";
+  EXPECT_NEAR(spun.right, -2, 0)
+    << "\nFAIL BehaviorMatrixPresetsAndConfig: custom right\n";
+}
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file differential_integrator_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_params.h"
+#include "../src/differential_integrator.h"
+#include "../src/fixed_differential_integrator.h"
+#include "../src/fixed_point.h"
+#include "../src/light.h"
+#include "../src/motion_behavior_differential.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef DIFFERENTIAL_INTEGRATOR_TEST
+
+class DifferentialIntegratorTest : public ::testing::Test {
+ public:
+  DifferentialIntegratorTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+  }
+
+  csci3081::arena_params aparams;
+};
+
+// The batch integrator and the scalar differential drive model run the same
+// kernel, so they agree to the bit
+TEST_F(DifferentialIntegratorTest, BatchIntegratorMatchesScalar) {
+  const double wheels[] = {0, 0.5, 3, 3, 7.25, 10};
+  const int n = sizeof(wheels) / sizeof(wheels[0]);
+  csci3081::DifferentialIntegrator batch;
+  batch.Resize(n * n);
+  csci3081::Light light;
+  csci3081::MotionBehaviorDifferential scalar(&light);
+  std::vector<csci3081::Pose> expected;
+  for (int l = 0; l < n; l++) {
+    for (int r = 0; r < n; r++) {
+      csci3081::Pose start(100 + 10 * l, 200 + 10 * r, 37.0 * (l * n + r));
+      csci3081::WheelVelocity vel(wheels[l], wheels[r]);
+      batch.Load(expected.size(), start,
+                 csci3081::Heading::FromDegrees(start.theta), vel);
+      light.set_pose(start);
+      scalar.UpdatePose(1, vel);
+      expected.push_back(light.get_pose());
+    }
+  }
+  batch.Integrate(0, batch.size(), 1);
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(batch.get_pose(i).x, expected[i].x)
+      << "\nFAIL BatchIntegratorMatchesScalar: x of slot " << i << "\n";
+    EXPECT_EQ(batch.get_pose(i).y, expected[i].y)
+      << "\nFAIL BatchIntegratorMatchesScalar: y of slot " << i << "\n";
+    EXPECT_EQ(batch.get_pose(i).theta, expected[i].theta)
+      << "\nFAIL BatchIntegratorMatchesScalar: theta of slot " << i << "\n";
+    EXPECT_NEAR(batch.get_heading(i).dx,
+                std::cos(csci3081::deg2rad(expected[i].theta)), 1e-12)
+      << "\nFAIL BatchIntegratorMatchesScalar: heading of slot " << i << "\n";
+  }
+}
+
+// The fixed point mode stays close to the double one, keeps every pose on
+// the Q16.16 grid and gives the same bits with any thread count
+TEST_F(DifferentialIntegratorTest, FixedPointIsBitExact) {
+  const int32_t *table = csci3081::FixedSinTable();
+  for (int k = 0; k < 4096; k++) {
+    double rad = 2 * M_PI * k / 4096 + 0.0007;
+    csci3081::FixedAngle angle =
+      csci3081::DegreesToAngle(csci3081::rad2deg(rad));
+    EXPECT_NEAR(csci3081::FixedSin(table, angle).ToDouble(), std::sin(rad),
+                3e-5) << "\nFAIL FixedPointIsBitExact: sin at " << k << "\n";
+  }
+  EXPECT_EQ(csci3081::IntegerSqrt(1ULL << 40), 1ULL << 20)
+    << "\nFAIL FixedPointIsBitExact: sqrt\n";
+
+  const double wheels[] = {0, 0.5, 3, 3, 7.25, 10};
+  const int n = sizeof(wheels) / sizeof(wheels[0]);
+  csci3081::DifferentialIntegrator batch;
+  csci3081::FixedDifferentialIntegrator fixed;
+  batch.Resize(n * n);
+  fixed.Resize(n * n);
+  for (int l = 0; l < n; l++) {
+    for (int r = 0; r < n; r++) {
+      csci3081::Pose start(100 + 10 * l, 200 + 10 * r, 37.0 * (l * n + r));
+      csci3081::Heading heading = csci3081::Heading::FromDegrees(start.theta);
+      csci3081::WheelVelocity vel(wheels[l], wheels[r]);
+      batch.Load(l * n + r, start, heading, vel);
+      fixed.Load(l * n + r, start, heading, vel);
+    }
+  }
+  batch.Integrate(0, batch.size(), 1);
+  fixed.Integrate(0, fixed.size(), 1);
+  for (size_t i = 0; i < batch.size(); i++) {
+    csci3081::Pose want = batch.get_pose(i);
+    csci3081::Pose got = fixed.get_pose(i);
+    EXPECT_NEAR(got.x, want.x, 1e-3)
+      << "\nFAIL FixedPointIsBitExact: x of slot " << i << "\n";
+    EXPECT_NEAR(got.y, want.y, 1e-3)
+      << "\nFAIL FixedPointIsBitExact: y of slot " << i << "\n";
+    EXPECT_NEAR(std::remainder(got.theta - want.theta, 360), 0, 1e-4)
+      << "\nFAIL FixedPointIsBitExact: theta of slot " << i << "\n";
+    EXPECT_NEAR(fixed.get_heading(i).dx, batch.get_heading(i).dx, 1e-4)
+      << "\nFAIL FixedPointIsBitExact: heading of slot " << i << "\n";
+  }
+
+  aparams.seed = 11;
+  aparams.fixed_point = true;
+  std::vector<csci3081::Pose> poses[2];
+  for (int run = 0; run < 2; run++) {
+    aparams.n_threads = run ? 4 : 1;
+    csci3081::Arena fixed_arena(&aparams);
+    EXPECT_TRUE(fixed_arena.get_fixed_point())
+      << "\nFAIL FixedPointIsBitExact: mode\n";
+    fixed_arena.StepTicks(500);
+    for (auto ent : fixed_arena.mobile_entities()) {
+      double x = ent->get_pose().x * 65536;
+      double y = ent->get_pose().y * 65536;
+      EXPECT_NEAR(x, std::round(x), 0)
+        << "\nFAIL FixedPointIsBitExact: x of " << ent->get_id()
+        << " off the grid\n";
+      EXPECT_NEAR(y, std::round(y), 0)
+        << "\nFAIL FixedPointIsBitExact: y of " << ent->get_id()
+        << " off the grid\n";
+    }
+    for (auto ent : fixed_arena.entities()) {
+      poses[run].push_back(ent->get_pose());
+    }
+  }
+  ASSERT_EQ(poses[0].size(), poses[1].size())
+    << "\nFAIL FixedPointIsBitExact\n";
+  for (size_t i = 0; i < poses[0].size(); i++) {
+    EXPECT_NEAR(poses[0][i].x, poses[1][i].x, 0)
+      << "\nFAIL FixedPointIsBitExact: entity " << i << " differs\n";
+    EXPECT_NEAR(poses[0][i].y, poses[1][i].y, 0)
+      << "\nFAIL FixedPointIsBitExact: entity " << i << " differs\n";
+  }
+}
+
+#endif
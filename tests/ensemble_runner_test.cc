@@ -0,0 +1,66 @@
+/**
+ * @file ensemble_runner_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_params.h"
+#include "../src/ensemble_runner.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef ENSEMBLE_RUNNER_TEST
+
+class EnsembleRunnerTest : public ::testing::Test {
+ public:
+  EnsembleRunnerTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+  }
+
+  csci3081::arena_params aparams;
+};
+
+// Arenas with the same seed are placed identically and run identically
+TEST_F(EnsembleRunnerTest, SeededReplicasAreReproducible) {
+  aparams.seed = 42;
+  aparams.n_threads = 1;
+  csci3081::Arena a(&aparams);
+  csci3081::Arena b(&aparams);
+  ASSERT_EQ(a.entities().size(), b.entities().size())
+    << "\nFAIL SeededReplicasAreReproducible\n";
+  a.StepTicks(100);
+  b.StepTicks(100);
+  for (size_t i = 0; i < a.entities().size(); i++) {
+    EXPECT_EQ(a.entities()[i]->get_pose().x, b.entities()[i]->get_pose().x)
+      << "\nFAIL SeededReplicasAreReproducible: pose\n";
+  }
+
+  csci3081::EnsembleRunner ensemble(aparams, 4, 100, 7, 2);
+  csci3081::EnsembleSummary summary = ensemble.Run();
+  EXPECT_EQ(summary.replicas, 4u) << "\nFAIL SeededReplicasAreReproducible\n";
+  EXPECT_EQ(summary.won + summary.lost + summary.survived, 4u)
+    << "\nFAIL SeededReplicasAreReproducible: outcomes\n";
+  for (size_t i = 0; i < ensemble.get_results().size(); i++) {
+    aparams.seed = 7 + static_cast<unsigned int>(i);
+    csci3081::ReplicaResult again =
+      csci3081::EnsembleRunner::RunReplica(aparams, 100);
+    EXPECT_EQ(again.ticks, ensemble.get_results()[i].ticks)
+      << "\nFAIL SeededReplicasAreReproducible: replica " << i << "\n";
+  }
+}
+
+#endif
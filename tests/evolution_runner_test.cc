@@ -0,0 +1,98 @@
+/**
+ * @file evolution_runner_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Project code from the ../src directory
+#include "../src/arena_config.h"
+#include "../src/arena_params.h"
+#include "../src/evolution_runner.h"
+#include "../src/sweep_runner.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef EVOLUTION_RUNNER_TEST
+
+class EvolutionRunnerTest : public ::testing::Test {
+ public:
+  EvolutionRunnerTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+  }
+
+  csci3081::arena_params aparams;
+};
+
+// An evolutionary search keeps its best genome, caches repeated genomes,
+// and breeds the same genomes whatever the thread count
+TEST_F(EvolutionRunnerTest, EvolutionKeepsBestAndCaches) {
+  csci3081::arena_params params = aparams;
+  EXPECT_TRUE(csci3081::SetArenaParamValue("fear_matrix.3", 0.25, &params))
+    << "\nFAIL EvolutionKeepsBestAndCaches: matrix weight name\n";
+  EXPECT_NEAR(params.fear_matrix.weights[0][3], 0.25, 0)
+    << "\nFAIL EvolutionKeepsBestAndCaches: matrix weight set\n";
+  EXPECT_FALSE(csci3081::SetArenaParamValue("fear_matrix.12", 1, &params))
+    << "\nFAIL EvolutionKeepsBestAndCaches: weight out of range\n";
+
+  params.robot_death = 20;
+  params.robot_starve = 10;
+  params.robot_hunger = 5;
+  std::vector<csci3081::SweepDimension> genes(2);
+  genes[0].name = "fear_matrix.3";
+  genes[0].min = -1;
+  genes[0].max = 1;
+  genes[1].name = "fear_matrix.10";
+  genes[1].min = -1;
+  genes[1].max = 1;
+  std::ostringstream serial_out, parallel_out;
+  csci3081::EvolutionRunner serial(params, genes, 4, 2, 40, 3, 1);
+  csci3081::EvolutionStats serial_best = serial.Run(3, serial_out);
+  csci3081::EvolutionRunner parallel(params, genes, 4, 2, 40, 3, 2);
+  csci3081::EvolutionStats parallel_best = parallel.Run(3, parallel_out);
+
+  EXPECT_EQ(serial_best.best_genome, parallel_best.best_genome)
+    << "\nFAIL EvolutionKeepsBestAndCaches: thread count changed search\n";
+  EXPECT_NEAR(serial_best.best, parallel_best.best, 0)
+    << "\nFAIL EvolutionKeepsBestAndCaches: thread count changed fitness\n";
+  // the kept genome is never run twice
+  EXPECT_LT(serial_best.evaluated, serial_best.population)
+    << "\nFAIL EvolutionKeepsBestAndCaches: cached genome rerun\n";
+  EXPECT_LE(serial.get_cache_size(), 4u + 3u + 3u)
+    << "\nFAIL EvolutionKeepsBestAndCaches: cache size\n";
+
+  // a header and one row per generation, best fitness never falling
+  std::istringstream rows(serial_out.str());
+  std::string line;
+  std::getline(rows, line);
+  double last_best = 0;
+  int generations = 0;
+  while (std::getline(rows, line)) {
+    std::istringstream fields(line);
+    std::string field;
+    for (int k = 0; k < 4; k++) std::getline(fields, field, ',');
+    double best = std::stod(field);
+    EXPECT_GE(best, last_best)
+      << "\nFAIL EvolutionKeepsBestAndCaches: best fitness fell\n";
+    last_best = best;
+    generations++;
+  }
+  EXPECT_EQ(generations, 3) << "\nFAIL EvolutionKeepsBestAndCaches: rows\n";
+}
+
+#endif
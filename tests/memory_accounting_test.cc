@@ -0,0 +1,123 @@
+/**
+ * @file memory_accounting_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_params.h"
+#include "../src/memory_accounting.h"
+#include "../src/neural_behavior.h"
+#include "../src/robot.h"
+#include "../src/robot_behavior.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef MEMORY_ACCOUNTING_TEST
+
+class MemoryAccountingTest : public ::testing::Test {
+ public:
+  MemoryAccountingTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+    arena = new csci3081::Arena(&aparams);
+  }
+
+  virtual void TearDown() { delete arena; }
+
+  csci3081::arena_params aparams;
+  csci3081::Arena *arena{nullptr};
+};
+
+// Repeated add/remove cycles must not leave anything behind
+TEST_F(MemoryAccountingTest, AddRemoveCyclesAreLeakFree) {
+  long robots = csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountRobot);
+  long sensors = csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountLightSensor);
+  long behaviors = csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountBehavior);
+  long touch = csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountTouchSensor);
+  for (int i = 0; i < 100; i++) {
+    arena->ChangeNumRobot(10, csci3081::kLove);
+    arena->ChangeNumLights(7);
+    arena->ChangeNumRobot(0, csci3081::kLove);
+    arena->ChangeNumLights(3);
+  }
+  EXPECT_EQ(csci3081::MemoryAccounting::live_objects(csci3081::kAccountRobot),
+            robots) << "\nFAIL AddRemoveCyclesAreLeakFree: robots\n";
+  EXPECT_EQ(csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountLightSensor), sensors)
+    << "\nFAIL AddRemoveCyclesAreLeakFree: sensors\n";
+  EXPECT_EQ(csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountBehavior), behaviors)
+    << "\nFAIL AddRemoveCyclesAreLeakFree: behaviors\n";
+  EXPECT_EQ(csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountTouchSensor), touch)
+    << "\nFAIL AddRemoveCyclesAreLeakFree: touch sensors\n";
+}
+
+// Destroying the arena frees every robot and what it owns
+TEST_F(MemoryAccountingTest, DestructorFreesEverything) {
+  long robots = csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountRobot);
+  long handlers = csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountMotionHandler);
+  delete arena;
+  arena = nullptr;
+  EXPECT_EQ(csci3081::MemoryAccounting::live_objects(csci3081::kAccountRobot),
+            robots - 5) << "\nFAIL DestructorFreesEverything: robots\n";
+  EXPECT_EQ(csci3081::MemoryAccounting::live_objects(
+    csci3081::kAccountMotionHandler), handlers - 5)
+    << "\nFAIL DestructorFreesEverything: handlers\n";
+}
+
+// A robot's bytes are counted once, its embedded members under their own
+// kinds and the rest under Robot
+TEST_F(MemoryAccountingTest, EmbeddedMembersCountedOnce) {
+  const csci3081::AccountedKind kinds[] = {
+    csci3081::kAccountRobot, csci3081::kAccountLightSensor,
+    csci3081::kAccountFoodSensor, csci3081::kAccountMotionHandler};
+  long before = 0;
+  for (csci3081::AccountedKind kind : kinds) {
+    before += csci3081::MemoryAccounting::live_bytes(kind);
+  }
+  csci3081::Robot *rob = new csci3081::Robot;
+  long after = 0;
+  for (csci3081::AccountedKind kind : kinds) {
+    after += csci3081::MemoryAccounting::live_bytes(kind);
+  }
+  EXPECT_EQ(after - before, static_cast<long>(sizeof(csci3081::Robot)))
+    << "\nFAIL EmbeddedMembersCountedOnce\n";
+  delete rob;
+}
+
+// A behavior is counted with the size of its own class
+TEST_F(MemoryAccountingTest, BehaviorsCountedAtTheirSize) {
+  long before = csci3081::MemoryAccounting::live_bytes(
+    csci3081::kAccountBehavior);
+  csci3081::RobotBehavior *behv = new csci3081::NeuralBehavior;
+  EXPECT_EQ(csci3081::MemoryAccounting::live_bytes(
+    csci3081::kAccountBehavior) - before,
+    static_cast<long>(sizeof(csci3081::NeuralBehavior)))
+    << "\nFAIL BehaviorsCountedAtTheirSize\n";
+  delete behv;
+  EXPECT_EQ(csci3081::MemoryAccounting::live_bytes(
+    csci3081::kAccountBehavior), before)
+    << "\nFAIL BehaviorsCountedAtTheirSize: released\n";
+}
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @file motion_model_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+// Project code from the ../src directory
+#include "../src/light.h"
+#include "../src/motion_behavior_differential.h"
+#include "../src/motion_model.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef MOTION_MODEL_TEST
+
+class MotionModelTest : public ::testing::Test {
+ public:
+  MotionModelTest() {}
+};
+
+// The motion models integrate exact arcs, and static and virtual dispatch
+// of a model agree
+TEST_F(MotionModelTest, MotionModelsAreExactArcs) {
+  csci3081::Light light;
+  csci3081::StaticMotionBehavior<csci3081::UnicycleModel> unicycle(&light);
+  // 0.5 rad per tick for pi ticks is a quarter turn on a circle of radius 4
+  csci3081::WheelVelocity vel(2.125, 1.875);
+  light.set_pose(csci3081::Pose(100, 100, 0));
+  unicycle.UpdatePose(M_PI, vel);
+  EXPECT_NEAR(light.get_pose().x, 104, 1e-12)
+    << "\nFAIL MotionModelsAreExactArcs: unicycle x\n";
+  EXPECT_NEAR(light.get_pose().y, 104, 1e-12)
+    << "\nFAIL MotionModelsAreExactArcs: unicycle y\n";
+  EXPECT_NEAR(light.get_pose().theta, 90, 1e-12)
+    << "\nFAIL MotionModelsAreExactArcs: unicycle theta\n";
+  EXPECT_NEAR(light.get_heading().dy, 1, 1e-12)
+    << "\nFAIL MotionModelsAreExactArcs: unicycle heading\n";
+
+  // the same turn taken in steps ends in the same place
+  light.set_pose(csci3081::Pose(100, 100, 0));
+  for (int i = 0; i < 8; i++) unicycle.UpdatePose(M_PI / 8, vel);
+  EXPECT_NEAR(light.get_pose().x, 104, 1e-12)
+    << "\nFAIL MotionModelsAreExactArcs: unicycle in steps\n";
+
+  // a holonomic base slides sideways without turning
+  csci3081::StaticMotionBehavior<csci3081::HolonomicModel> holonomic(&light);
+  light.set_pose(csci3081::Pose(100, 100, 90));
+  holonomic.UpdatePose(2, csci3081::WheelVelocity(0, 3));
+  EXPECT_NEAR(light.get_pose().x, 94, 1e-12)
+    << "\nFAIL MotionModelsAreExactArcs: holonomic\n";
+  EXPECT_NEAR(light.get_pose().theta, 90, 0)
+    << "\nFAIL MotionModelsAreExactArcs: holonomic turned\n";
+
+  // the differential model is the one MotionBehaviorDifferential runs
+  csci3081::Light other;
+  csci3081::StaticMotionBehavior<csci3081::DifferentialDriveModel>
+    fixed(&light);
+  csci3081::MotionBehaviorDifferential dynamic(&other);
+  light.set_pose(csci3081::Pose(300, 200, 33));
+  other.set_pose(csci3081::Pose(300, 200, 33));
+  for (int i = 0; i < 20; i++) {
+    csci3081::WheelVelocity wheels(3 + 0.1 * i, 4 - 0.2 * i);
+    fixed.UpdatePose(1, wheels);
+    dynamic.UpdatePose(1, wheels);
+  }
+  EXPECT_NEAR(light.get_pose().x, other.get_pose().x, 0)
+    << "\nFAIL MotionModelsAreExactArcs: differential x\n";
+  EXPECT_NEAR(light.get_pose().y, other.get_pose().y, 0)
+    << "\nFAIL MotionModelsAreExactArcs: differential y\n";
+}
+
+#endif
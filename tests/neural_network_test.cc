@@ -0,0 +1,105 @@
+/**
+ * @file neural_network_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_config.h"
+#include "../src/arena_params.h"
+#include "../src/behavior_batch.h"
+#include "../src/neural_network.h"
+#include "../src/robot.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef NEURAL_NETWORK_TEST
+
+class NeuralNetworkTest : public ::testing::Test {
+ public:
+  NeuralNetworkTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+  }
+
+  csci3081::arena_params aparams;
+};
+
+// Neural robots load their network from a weights file, and a batch of
+// them gets the velocities Movement() gives each one
+TEST_F(NeuralNetworkTest, NeuralBatchMatchesMovement) {
+  std::string path = ::testing::TempDir() + "neural_network_test.txt";
+  {
+    std::ofstream out(path);
+    out << "3  # hidden units\n"
+        << "0.1 -0.2 0.01 0.3 -0.1 0.5\n"
+        << "-0.4 0.2 0 0.05 0.2 -1\n"
+        << "0.3 0.3 -0.02 -0.2 0.1 0\n"
+        << "4 -2 1 3\n"
+        << "-1 5 2 2.5\n";
+  }
+  csci3081::arena_params params = aparams;
+  params.n_neural_robots = 40;
+  EXPECT_TRUE(csci3081::SetArenaParam("neural_weights", path, &params))
+    << "\nFAIL NeuralBatchMatchesMovement: weights not loaded\n";
+  EXPECT_EQ(params.neural_network.hidden, 3u)
+    << "\nFAIL NeuralBatchMatchesMovement: hidden units\n";
+  {
+    std::ofstream out(path);
+    out << "3\n1 2 3\n";
+  }
+  EXPECT_FALSE(csci3081::SetArenaParam("neural_weights", path, &params))
+    << "\nFAIL NeuralBatchMatchesMovement: short file accepted\n";
+  std::remove(path.c_str());
+
+  csci3081::Arena net_arena(&params);
+  std::vector<csci3081::Robot *> neural;
+  for (csci3081::Robot *rob : net_arena.robots()) {
+    if (rob->get_behavior_enum() == csci3081::kNeural) neural.push_back(rob);
+  }
+  ASSERT_EQ(neural.size(), 40u)
+    << "\nFAIL NeuralBatchMatchesMovement: neural robots added\n";
+  csci3081::BehaviorBatch batch;
+  batch.Resize(neural.size());
+  for (size_t k = 0; k < neural.size(); k++) {
+    csci3081::Robot *rob = neural[k];
+    rob->set_hunger_state(10, 10, 10, k % 4 > 0, k % 4 > 2);
+    rob->get_left_light_sensor()->set_reading(0.7 * k);
+    rob->get_right_light_sensor()->set_reading(11 - 0.3 * k);
+    rob->get_left_food_sensor()->set_reading(0.2 * k);
+    rob->get_right_food_sensor()->set_reading(5 - 0.25 * k);
+    batch.Load(k, rob);
+  }
+  batch.Decide(0, neural.size());
+  for (size_t k = 0; k < neural.size(); k++) {
+    csci3081::Robot *rob = neural[k];
+    double food_left = 0.2 * k, food_right = 5 - 0.25 * k;
+    csci3081::WheelVelocity want = rob->get_is_starving() ?
+      csci3081::WheelVelocity(0.4 * food_right, 0.4 * food_left) :
+      rob->get_motion_handler()->get_behavior()->Movement(
+        0.7 * k, 11 - 0.3 * k, food_left, food_right, rob->get_is_hungry());
+    EXPECT_NEAR(batch.get_velocity(k).left, want.left, 0)
+      << "\nFAIL NeuralBatchMatchesMovement: robot " << k << "\n";
+    EXPECT_NEAR(batch.get_velocity(k).right, want.right, 0)
+      << "\nFAIL NeuralBatchMatchesMovement: robot " << k << "\n";
+  }
+}
+
+#endif
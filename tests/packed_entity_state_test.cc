@@ -0,0 +1,82 @@
+/**
+ * @file packed_entity_state_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <vector>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_params.h"
+#include "../src/packed_entity_state.h"
+#include "../src/robot.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef PACKED_ENTITY_STATE_TEST
+
+class PackedEntityStateTest : public ::testing::Test {
+ public:
+  PackedEntityStateTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+    arena = new csci3081::Arena(&aparams);
+  }
+
+  virtual void TearDown() { delete arena; }
+
+  csci3081::arena_params aparams;
+  csci3081::Arena *arena{nullptr};
+};
+
+// Packing keeps every entity in 32 bytes and round-trips the accessors
+TEST_F(PackedEntityStateTest, PackedStateRoundTrip) {
+  std::vector<csci3081::PackedEntityState> packed;
+  csci3081::ColorPalette palette;
+  arena->PackState(&packed, &palette);
+  ASSERT_EQ(packed.size(), arena->entities().size())
+    << "\nFAIL PackedStateRoundTrip: size\n";
+  for (size_t i = 0; i < packed.size(); i++) {
+    csci3081::ArenaEntity *ent = arena->entities()[i];
+    EXPECT_NEAR(packed[i].get_pose().x, ent->get_pose().x, 1e-3)
+      << "\nFAIL PackedStateRoundTrip: pose.x\n";
+    EXPECT_EQ(packed[i].get_type(), ent->get_type())
+      << "\nFAIL PackedStateRoundTrip: type\n";
+    EXPECT_EQ(packed[i].get_color(palette).b, ent->get_color().b)
+      << "\nFAIL PackedStateRoundTrip: color\n";
+  }
+  csci3081::Robot rob;
+  csci3081::UnpackRobot(packed[0], palette, &rob);
+  EXPECT_EQ(rob.get_behavior_enum(), csci3081::kFear)
+    << "\nFAIL PackedStateRoundTrip: behavior\n";
+  EXPECT_EQ(rob.get_hungry(), ROBOT_HUNGER)
+    << "\nFAIL PackedStateRoundTrip: hunger\n";
+
+  // a colour outside the fixed palette comes back exactly
+  rob.set_color(csci3081::RgbColor(17, 201, 99));
+  size_t fixed = palette.size();
+  csci3081::PackedEntityState odd = csci3081::PackRobot(rob, &palette);
+  EXPECT_EQ(palette.size(), fixed + 1)
+    << "\nFAIL PackedStateRoundTrip: palette miss\n";
+  EXPECT_EQ(csci3081::PackRobot(rob, &palette).color_index, odd.color_index)
+    << "\nFAIL PackedStateRoundTrip: palette miss added twice\n";
+  csci3081::Robot copy;
+  csci3081::UnpackRobot(odd, palette, &copy);
+  EXPECT_EQ(copy.get_color().r, 17) << "\nFAIL PackedStateRoundTrip: r\n";
+  EXPECT_EQ(copy.get_color().g, 201) << "\nFAIL PackedStateRoundTrip: g\n";
+  EXPECT_EQ(copy.get_color().b, 99) << "\nFAIL PackedStateRoundTrip: b\n";
+}
+
+#endif
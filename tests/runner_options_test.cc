@@ -0,0 +1,144 @@
+/**
+ * @file runner_options_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Project code from the ../src directory
+#include "../src/runner_options.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef RUNNER_OPTIONS_TEST
+
+class RunnerOptionsTest : public ::testing::Test {
+ public:
+  RunnerOptionsTest() {}
+
+ protected:
+  // Parse `args` as if they followed the program name on a command line
+  csci3081::RunnerOptionsStatus Parse(const std::vector<std::string> &args) {
+    std::vector<const char *> argv(1, "arenarunner");
+    for (const std::string &arg : args) argv.push_back(arg.c_str());
+    options = csci3081::RunnerOptions();
+    error.clear();
+    return csci3081::ParseRunnerOptions(static_cast<int>(argv.size()),
+                                        argv.data(), &options, &error);
+  }
+
+  csci3081::RunnerOptions options;
+  std::string error;
+};
+
+// A count is digits only, within its bound
+TEST_F(RunnerOptionsTest, ParseCountTakesDigitsOnly) {
+  unsigned long value = 0;
+  EXPECT_TRUE(csci3081::ParseCount("0", UINT_MAX, &value))
+    << "\nFAIL ParseCountTakesDigitsOnly: 0\n";
+  EXPECT_EQ(value, 0u) << "\nFAIL ParseCountTakesDigitsOnly: 0\n";
+  EXPECT_TRUE(csci3081::ParseCount("4294967295", UINT_MAX, &value))
+    << "\nFAIL ParseCountTakesDigitsOnly: UINT_MAX\n";
+  EXPECT_EQ(value, 4294967295ul)
+    << "\nFAIL ParseCountTakesDigitsOnly: UINT_MAX\n";
+
+  const char *bad[] = {"", "-1", "+1", " 1", "12x", "1.5", "4294967296"};
+  for (const char *text : bad) {
+    EXPECT_FALSE(csci3081::ParseCount(text, UINT_MAX, &value))
+      << "\nFAIL ParseCountTakesDigitsOnly: accepted \"" << text << "\"\n";
+  }
+  EXPECT_FALSE(csci3081::ParseCount("99999999999999999999999", ULONG_MAX,
+                                    &value))
+    << "\nFAIL ParseCountTakesDigitsOnly: accepted an overflow\n";
+}
+
+// Well formed options land in the fields they name
+TEST_F(RunnerOptionsTest, GoodOptionsApply) {
+  ASSERT_EQ(Parse({"ticks=500", "threads=2", "seed=9", "replicas=3",
+                   "fear=7", "light_speed=2.5", "bench=100",
+                   "step_bench=1", "sweep.hunger=100:300:3",
+                   "design=random", "samples=5", "out=x.csv",
+                   "evolve.fear_matrix.3=-1:1", "population=8",
+                   "generations=4"}), csci3081::kOptionsOk) << error;
+  EXPECT_EQ(options.ticks, 500u) << "\nFAIL GoodOptionsApply: ticks\n";
+  EXPECT_EQ(options.params.n_threads, 2u)
+    << "\nFAIL GoodOptionsApply: threads\n";
+  EXPECT_EQ(options.params.seed, 9u) << "\nFAIL GoodOptionsApply: seed\n";
+  EXPECT_EQ(options.replicas, 3u) << "\nFAIL GoodOptionsApply: replicas\n";
+  EXPECT_EQ(options.params.n_fear_robots, 7u)
+    << "\nFAIL GoodOptionsApply: scenario setting\n";
+  EXPECT_EQ(options.params.light_speed, 2.5)
+    << "\nFAIL GoodOptionsApply: scenario setting\n";
+  EXPECT_EQ(options.bench, 100u) << "\nFAIL GoodOptionsApply: bench\n";
+  EXPECT_TRUE(options.step_bench) << "\nFAIL GoodOptionsApply: step_bench\n";
+  ASSERT_EQ(options.dims.size(), 1u) << "\nFAIL GoodOptionsApply: sweep\n";
+  EXPECT_EQ(options.dims[0].name, "hunger")
+    << "\nFAIL GoodOptionsApply: sweep name\n";
+  EXPECT_EQ(options.dims[0].steps, 3u)
+    << "\nFAIL GoodOptionsApply: sweep steps\n";
+  EXPECT_EQ(options.design, csci3081::kRandomDesign)
+    << "\nFAIL GoodOptionsApply: design\n";
+  EXPECT_EQ(options.samples, 5u) << "\nFAIL GoodOptionsApply: samples\n";
+  EXPECT_EQ(options.out, "x.csv") << "\nFAIL GoodOptionsApply: out\n";
+  ASSERT_EQ(options.genes.size(), 1u) << "\nFAIL GoodOptionsApply: gene\n";
+  EXPECT_EQ(options.genes[0].min, -1)
+    << "\nFAIL GoodOptionsApply: gene range\n";
+  EXPECT_EQ(options.population, 8u)
+    << "\nFAIL GoodOptionsApply: population\n";
+  EXPECT_EQ(options.generations, 4u)
+    << "\nFAIL GoodOptionsApply: generations\n";
+
+  ASSERT_EQ(Parse({}), csci3081::kOptionsOk) << error;
+  EXPECT_EQ(options.ticks, 10000u) << "\nFAIL GoodOptionsApply: default\n";
+}
+
+// Malformed options are refused and named in the error
+TEST_F(RunnerOptionsTest, MalformedOptionsRejected) {
+  const char *bad[] = {
+    "ticks=", "ticks=-1", "ticks=12x", "ticks=99999999999999999999999",
+    "threads=4294967296", "seed=-5", "replicas= 2", "population=1e3",
+    "nonsense", "bogus=1", "food_radius=big", "sweep.hunger=100",
+    "sweep.bogus=1:2", "sweep.hunger=1:2:x", "evolve.fear_matrix.3=-1"};
+  for (const char *arg : bad) {
+    EXPECT_EQ(Parse({arg}), csci3081::kOptionsBadArgument)
+      << "\nFAIL MalformedOptionsRejected: accepted " << arg << "\n";
+    EXPECT_NE(error.find(arg), std::string::npos)
+      << "\nFAIL MalformedOptionsRejected: error \"" << error << "\"\n";
+  }
+}
+
+// The scenario file is loaded first, wherever it appears, and the settings
+// must fit together once everything is applied
+TEST_F(RunnerOptionsTest, ScenarioLoadedFirstAndChecked) {
+  std::string path = ::testing::TempDir() + "runner_options_test.txt";
+  {
+    std::ofstream out(path);
+    out << "fear = 4\nseed = 3\n";
+  }
+  ASSERT_EQ(Parse({"seed=5", "config=" + path}), csci3081::kOptionsOk)
+    << error;
+  EXPECT_EQ(options.params.seed, 5u)
+    << "\nFAIL ScenarioLoadedFirstAndChecked: override lost\n";
+  EXPECT_EQ(options.params.n_fear_robots, 4u)
+    << "\nFAIL ScenarioLoadedFirstAndChecked: file not loaded\n";
+  std::remove(path.c_str());
+  EXPECT_EQ(Parse({"config=" + path}), csci3081::kOptionsBadScenario)
+    << "\nFAIL ScenarioLoadedFirstAndChecked: missing file\n";
+
+  EXPECT_EQ(Parse({"neural=2"}), csci3081::kOptionsBadScenario)
+    << "\nFAIL ScenarioLoadedFirstAndChecked: neural without weights\n";
+  EXPECT_EQ(Parse({"neural=0", "sweep.neural=0:2"}),
+            csci3081::kOptionsBadScenario)
+    << "\nFAIL ScenarioLoadedFirstAndChecked: swept neural count\n";
+}
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * @file simulation_runner_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+// Project code from the ../src directory
+#include "../src/arena.h"
+#include "../src/arena_params.h"
+#include "../src/simulation_runner.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef SIMULATION_RUNNER_TEST
+
+class SimulationRunnerTest : public ::testing::Test {
+ public:
+  SimulationRunnerTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.seed = 5;
+    aparams.n_threads = 1;
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+  }
+
+  csci3081::arena_params aparams;
+};
+
+// Run steps up to its limit while the game is playing
+TEST_F(SimulationRunnerTest, RunStopsAtMaxTicks) {
+  csci3081::SimulationRunner runner(&aparams);
+  csci3081::RunResult result = runner.Run(50);
+  EXPECT_EQ(result.ticks, 50u) << "\nFAIL RunStopsAtMaxTicks: ticks\n";
+  EXPECT_EQ(result.status, PLAYING) << "\nFAIL RunStopsAtMaxTicks: status\n";
+  EXPECT_EQ(runner.get_arena()->get_tick(), 50u)
+    << "\nFAIL RunStopsAtMaxTicks: arena clock\n";
+  EXPECT_EQ(result.entity_updates,
+            50u * runner.get_arena()->entities().size())
+    << "\nFAIL RunStopsAtMaxTicks: entity updates\n";
+}
+
+// Run stops on the tick the game is lost, and Benchmark steps on past it
+TEST_F(SimulationRunnerTest, RunStopsWhenTheGameEnds) {
+  aparams.robot_hunger = 5;
+  aparams.robot_starve = 10;
+  aparams.robot_death = 20;
+  csci3081::SimulationRunner runner(&aparams);
+  csci3081::RunResult result = runner.Run(100000);
+  EXPECT_EQ(result.status, LOST)
+    << "\nFAIL RunStopsWhenTheGameEnds: status\n";
+  EXPECT_LT(result.ticks, 100000u)
+    << "\nFAIL RunStopsWhenTheGameEnds: ran on after the game ended\n";
+  std::ostringstream report;
+  runner.Report(result, report);
+  EXPECT_NE(report.str().find("status:              lost"),
+            std::string::npos)
+    << "\nFAIL RunStopsWhenTheGameEnds: report\n" << report.str();
+
+  csci3081::SimulationRunner bench(&aparams);
+  csci3081::RunResult timed = bench.Benchmark(result.ticks + 100);
+  EXPECT_EQ(timed.ticks, result.ticks + 100)
+    << "\nFAIL RunStopsWhenTheGameEnds: benchmark ticks\n";
+  EXPECT_EQ(bench.get_arena()->get_tick(), result.ticks + 100)
+    << "\nFAIL RunStopsWhenTheGameEnds: benchmark stopped early\n";
+}
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * @file sweep_runner_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Project code from the ../src directory
+#include "../src/arena_params.h"
+#include "../src/sweep_runner.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef SWEEP_RUNNER_TEST
+
+class SweepRunnerTest : public ::testing::Test {
+ public:
+  SweepRunnerTest() {}
+
+ protected:
+  virtual void SetUp() {
+    aparams.n_lights = 3;
+    aparams.n_foods = 2;
+    aparams.n_fear_robots = 2;
+    aparams.n_aggressive_robots = 1;
+    aparams.n_explore_robots = 2;
+    aparams.n_love_robots = 0;
+  }
+
+  csci3081::arena_params aparams;
+};
+
+// A sweep enumerates its grid and resumes from the rows already written,
+// but only by the same sweep
+TEST_F(SweepRunnerTest, SweepResumesFromCheckpoint) {
+  std::vector<csci3081::SweepDimension> dims(2);
+  dims[0].name = "hunger";
+  dims[0].min = 100;
+  dims[0].max = 300;
+  dims[0].steps = 3;
+  dims[1].name = "fear";
+  dims[1].min = 1;
+  dims[1].max = 2;
+  dims[1].steps = 2;
+  csci3081::SweepRunner sweep(aparams, dims, csci3081::kGridDesign, 0, 1, 10,
+                              3, 2);
+  ASSERT_EQ(sweep.num_configs(), 6u) << "\nFAIL SweepResumesFromCheckpoint\n";
+  EXPECT_EQ(sweep.ConfigValues(4)[0], 200)
+    << "\nFAIL SweepResumesFromCheckpoint: grid value\n";
+  EXPECT_EQ(sweep.ConfigValues(4)[1], 2)
+    << "\nFAIL SweepResumesFromCheckpoint: grid value\n";
+  EXPECT_FALSE(csci3081::SweepRunner::ApplyValue("bogus", 1, &aparams))
+    << "\nFAIL SweepResumesFromCheckpoint: unknown tunable\n";
+
+  std::string path = ::testing::TempDir() + "sweep_runner_test.csv";
+  std::remove(path.c_str());
+  EXPECT_EQ(sweep.Run(path), 6) << "\nFAIL SweepResumesFromCheckpoint\n";
+  EXPECT_EQ(sweep.Run(path), 0)
+    << "\nFAIL SweepResumesFromCheckpoint: finished rows rerun\n";
+  // a sweep with another seed does not take those rows as its own
+  csci3081::SweepRunner other(aparams, dims, csci3081::kGridDesign, 0, 1, 10,
+                              4, 2);
+  EXPECT_EQ(other.Run(path), -2)
+    << "\nFAIL SweepResumesFromCheckpoint: resumed a different sweep\n";
+  EXPECT_EQ(sweep.Run(path), 0)
+    << "\nFAIL SweepResumesFromCheckpoint: refused file changed\n";
+  std::remove(path.c_str());
+}
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * @file thread_pool_test.cc
+ *
+ * @copyright 2018 Osamah Anwar, All rights reserved.
+ */
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+// Project code from the ../src directory
+#include "../src/task_graph.h"
+#include "../src/thread_pool.h"
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+#ifdef THREAD_POOL_TEST
+
+class ThreadPoolTest : public ::testing::Test {
+ public:
+  ThreadPoolTest() {}
+};
+
+// ParallelFor visits every index exactly once, with any thread count
+TEST_F(ThreadPoolTest, ParallelForCoversRange) {
+  for (unsigned int threads = 1; threads <= 8; threads *= 2) {
+    csci3081::ThreadPool pool(threads);
+    std::vector<int> visits(1003, 0);
+    for (int rep = 0; rep < 3; rep++) {
+      pool.ParallelFor(visits.size(), [&visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) ++visits[i];
+      });
+    }
+    for (size_t i = 0; i < visits.size(); i++) {
+      EXPECT_EQ(visits[i], 3) << "\nFAIL ParallelForCoversRange: index "
+                              << i << " with " << threads << " threads\n";
+    }
+  }
+}
+
+// Tasks only start once everything they depend on has finished
+TEST_F(ThreadPoolTest, TaskGraphOrdersDependencies) {
+  csci3081::ThreadPool pool(4);
+  csci3081::TaskGraph graph;
+  std::vector<long> a(4000, 0);
+  std::vector<long> b(4000, 0);
+  long sum = 0;
+  auto fill = graph.AddRangeTasks(a.size(), 100,
+    [&a](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) a[i] = i;
+    });
+  auto twice = graph.AddRangeTasks(b.size(), 100,
+    [&a, &b](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) b[i] = 2 * a[i];
+    });
+  for (size_t c = 0; c < fill.size(); c++) {
+    graph.AddDependency(fill[c], twice[c]);
+  }
+  auto total = graph.AddTask([&b, &sum]() {
+    sum = 0;
+    for (long v : b) sum += v;
+  });
+  graph.AddDependency(twice, total);
+
+  for (int rep = 0; rep < 20; rep++) {
+    std::fill(a.begin(), a.end(), 0);
+    std::fill(b.begin(), b.end(), 0);
+    pool.Run(&graph);
+    EXPECT_EQ(sum, 3999L * 4000L) << "\nFAIL TaskGraphOrdersDependencies\n";
+  }
+}
+
+#endif